@@ -0,0 +1,81 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/evaluationcontext.hpp>
+#include <atomic>
+#include <vector>
+
+namespace QuantLib {
+
+    namespace {
+
+        thread_local Integer currentContext = 0;
+
+        std::vector<std::function<void(Integer)> >& releasers() {
+            static std::vector<std::function<void(Integer)> > releasers;
+            return releasers;
+        }
+
+    }
+
+    EvaluationContext::EvaluationContext() {
+        static std::atomic<Integer> lastId(0);
+        // identifiers are never reused, so that instances cached by
+        // the singletons can't be mistaken for those of a new context
+        id_ = ++lastId;
+    }
+
+    EvaluationContext::~EvaluationContext() {
+        std::vector<std::function<void(Integer)> > toBeCalled;
+        {
+            std::lock_guard<std::recursive_mutex> lock(mutex());
+            toBeCalled = releasers();
+        }
+        for (const auto& release : toBeCalled)
+            release(id_);
+    }
+
+    Integer EvaluationContext::current() {
+        return currentContext;
+    }
+
+    std::recursive_mutex& EvaluationContext::mutex() {
+        static std::recursive_mutex mutex;
+        return mutex;
+    }
+
+    void EvaluationContext::addReleaser(
+                                std::function<void(Integer)> releaser) {
+        std::lock_guard<std::recursive_mutex> lock(mutex());
+        releasers().push_back(std::move(releaser));
+    }
+
+    EvaluationContext::Guard::Guard(const EvaluationContext& context)
+    : previous_(currentContext) {
+        currentContext = context.id();
+    }
+
+    EvaluationContext::Guard::Guard(Integer id)
+    : previous_(currentContext) {
+        currentContext = id;
+    }
+
+    EvaluationContext::Guard::~Guard() {
+        currentContext = previous_;
+    }
+
+}
@@ -0,0 +1,109 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file evaluationcontext.hpp
+    \brief per-thread selection of global settings and fixings
+*/
+
+#ifndef quantlib_evaluation_context_hpp
+#define quantlib_evaluation_context_hpp
+
+#include <ql/types.hpp>
+#include <functional>
+#include <mutex>
+
+namespace QuantLib {
+
+    //! independent set of global settings, fixings and flags
+    /*! Each context owns its own instance of every singleton, i.e.,
+        its own Settings (evaluation date and flags), IndexManager
+        (fixings), ObservableSettings and so on.  Threads work in the
+        default context until another one is made current by means of
+        a Guard; tasks run by a ThreadPool work in the context that
+        was current when they were submitted.
+
+        This allows, e.g., to price a portfolio as of several dates
+        concurrently:
+        \code
+        EvaluationContext tomorrow;
+        std::thread t([&]() {
+            EvaluationContext::Guard guard(tomorrow);
+            Settings::instance().evaluationDate() = today + 1;
+            // load fixings, build and price the portfolio
+        });
+        // price the portfolio as of today
+        t.join();
+        \endcode
+
+        \warning Objects register with the settings of the context in
+                 which they are built, and the instances belonging to
+                 a context are released when the latter is destroyed.
+                 Objects should therefore be built and used in a single
+                 context, and destroyed before it; no thread should be
+                 working in a context when it is destroyed.
+
+        \note Contexts have no effect when sessions are enabled (the
+              user-supplied sessionId() selects the instances) or when
+              thread-safe singleton initialization is enabled.
+    */
+    class EvaluationContext {
+      public:
+        //! creates a new context with default settings and no fixings
+        EvaluationContext();
+        ~EvaluationContext();
+        EvaluationContext(const EvaluationContext&) = delete;
+        EvaluationContext& operator=(const EvaluationContext&) = delete;
+
+        //! identifier of the context
+        Integer id() const { return id_; }
+        //! identifier of the context current on the calling thread
+        /*! The default context has identifier 0. */
+        static Integer current();
+
+        //! makes a context current on the calling thread while in scope
+        class Guard {
+          public:
+            explicit Guard(const EvaluationContext& context);
+            /*! makes current the context with the given identifier;
+                this allows to propagate the current context to other
+                threads.
+            */
+            explicit Guard(Integer id);
+            ~Guard();
+            Guard(const Guard&) = delete;
+            Guard& operator=(const Guard&) = delete;
+          private:
+            Integer previous_;
+        };
+
+        /*! \name Singleton support
+            Used by Singleton to manage the instances of each context.
+        */
+        //@{
+        //! serializes the access to the instances
+        static std::recursive_mutex& mutex();
+        //! registers a function releasing the instances of a context
+        static void addReleaser(std::function<void(Integer)> releaser);
+        //@}
+      private:
+        Integer id_;
+    };
+
+}
+
+
+#endif
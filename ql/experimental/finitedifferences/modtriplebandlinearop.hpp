@@ -38,9 +38,10 @@ namespace QuantLib {
         explicit ModTripleBandLinearOp(const TripleBandLinearOp& m)
         : TripleBandLinearOp(m) { }
 
-	std::vector<Real>& lower() { return lower_; }
-        std::vector<Real>& diag()  { return diag_; }
-        std::vector<Real>& upper() { return upper_; }
+        // the bands might be modified through the returned references
+	std::vector<Real>& lower() { resetFactorization(); return lower_; }
+        std::vector<Real>& diag()  { resetFactorization(); return diag_; }
+        std::vector<Real>& upper() { resetFactorization(); return upper_; }
     };
 }
 
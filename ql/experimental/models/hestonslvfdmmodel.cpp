@@ -245,6 +245,11 @@ namespace QuantLib {
               case FdmSchemeDesc::ImplicitEulerType:
                   return std::make_shared<FdmSchemeWrapper<ImplicitEulerScheme>>(
                           std::make_unique<ImplicitEulerScheme>(op));
+              case FdmSchemeDesc::ImplicitEulerSparseType:
+                  return std::make_shared<FdmSchemeWrapper<ImplicitEulerScheme>>(
+                          std::make_unique<ImplicitEulerScheme>(
+                              op, ImplicitEulerScheme::bc_set(), 1e-8,
+                              ImplicitEulerScheme::SparseBiCGstab));
               case FdmSchemeDesc::ExplicitEulerType:
                   return std::make_shared<FdmSchemeWrapper<ExplicitEulerScheme>>(
                           std::make_unique<ExplicitEulerScheme>(op));
@@ -87,4 +87,12 @@ namespace QuantLib {
         }
     }
 
+    void ExtendedBlackScholesMertonProcess::evolveBatch(Time t0, Time dt,
+                                                        Size n,
+                                                        const Real* x0,
+                                                        const Real* dw,
+                                                        Real* x1) const {
+        StochasticProcess1D::evolveBatch(t0, dt, n, x0, dw, x1);
+    }
+
 }
@@ -48,6 +48,12 @@ namespace QuantLib {
         Real drift(Time t, Real x) const;
         Real diffusion(Time t, Real x) const;
         Real evolve(Time t0, Real x0, Time dt, Real dw) const;
+        /*! evolves each value through evolve(), since the exact
+            kernel of the base class doesn't apply to the schemes
+            above
+        */
+        void evolveBatch(Time t0, Time dt, Size n,
+                         const Real* x0, const Real* dw, Real* x1) const;
       private:
         const Discretization discretization_;
     };
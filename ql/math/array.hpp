@@ -340,7 +340,7 @@ namespace QuantLib {
                    "arrays with different sizes (" << data_.size() << ", "
                                                    << v.data_.size() << ") cannot be subtracted");
         std::transform(begin(), end(), v.begin(), begin(),
-                       [](Real i, Real j) { return i + j; });
+                       [](Real i, Real j) { return i - j; });
         return *this;
     }
 
@@ -57,6 +57,15 @@ namespace QuantLib {
         return result;
     }
 
+    void CumulativeNormalDistribution::operator()(const Real* begin,
+                                                  const Real* end,
+                                                  Real* out) const {
+        const Real average = average_, sigma = sigma_;
+        const Size n = end - begin;
+        for (Size i=0; i<n; ++i)
+            out[i] = detail::cumulativeNormal((begin[i] - average)/sigma);
+    }
+
     const CumulativeNormalDistribution InverseCumulativeNormal::f_;
 
     // Coefficients for the rational approximation.
@@ -118,6 +127,34 @@ namespace QuantLib {
         return z;
     }
 
+    void InverseCumulativeNormal::operator()(const Real* begin,
+                                             const Real* end,
+                                             Real* out) const {
+        const Size n = end - begin;
+        // double copies of the coefficients keep the loop vectorizable
+        const Real a1 = a1_, a2 = a2_, a3 = a3_, a4 = a4_, a5 = a5_,
+                   a6 = a6_, b1 = b1_, b2 = b2_, b3 = b3_, b4 = b4_,
+                   b5 = b5_;
+        for (Size i=0; i<n; ++i) {
+            const Real z = begin[i] - 0.5;
+            const Real r = z*z;
+            out[i] = (((((a1*r + a2)*r + a3)*r + a4)*r + a5)*r + a6)*z /
+                (((((b1*r + b2)*r + b3)*r + b4)*r + b5)*r + 1.0);
+        }
+
+        const Real xLow = x_low_, xHigh = x_high_;
+        for (Size i=0; i<n; ++i) {
+            if (begin[i] < xLow || xHigh < begin[i])
+                out[i] = tail_value(begin[i]);
+        }
+
+        if (average_ != 0.0 || sigma_ != 1.0) {
+            const Real average = average_, sigma = sigma_;
+            for (Size i=0; i<n; ++i)
+                out[i] = average + sigma*out[i];
+        }
+    }
+
     const long double MoroInverseCumulativeNormal::a0_ =  2.50662823884;
     const long double MoroInverseCumulativeNormal::a1_ =-18.61500062529;
     const long double MoroInverseCumulativeNormal::a2_ = 41.39119773534;
@@ -169,6 +206,46 @@ namespace QuantLib {
         return average_ + result*sigma_;
     }
 
+    void MoroInverseCumulativeNormal::operator()(const Real* begin,
+                                                 const Real* end,
+                                                 Real* out) const {
+        const Size n = end - begin;
+        for (Size i=0; i<n; ++i) {
+            QL_REQUIRE(begin[i] > 0.0 && begin[i] < 1.0,
+                       "MoroInverseCumulativeNormal(" << begin[i]
+                       << ") undefined: must be 0<x<1");
+        }
+
+        // double copies of the coefficients keep the loop vectorizable
+        const Real a0 = a0_, a1 = a1_, a2 = a2_, a3 = a3_,
+                   b0 = b0_, b1 = b1_, b2 = b2_, b3 = b3_;
+        for (Size i=0; i<n; ++i) {
+            // Beasley and Springer, 1977
+            const Real temp = begin[i] - 0.5;
+            const Real r = temp*temp;
+            out[i] = temp*(((a3*r + a2)*r + a1)*r + a0) /
+                ((((b3*r + b2)*r + b1)*r + b0)*r + 1.0);
+        }
+
+        for (Size i=0; i<n; ++i) {
+            const Real x = begin[i];
+            if (std::fabs(x - 0.5) >= 0.42) {
+                // improved approximation for the tail (Moro 1995)
+                Real result = std::log(-std::log(x < 0.5 ? x : 1.0 - x));
+                result = c0_+result*(c1_+result*(c2_+result*(c3_+result*
+                                       (c4_+result*(c5_+result*(c6_+result*
+                                                           (c7_+result*c8_)))))));
+                out[i] = x < 0.5 ? -result : result;
+            }
+        }
+
+        if (average_ != 0.0 || sigma_ != 1.0) {
+            const Real average = average_, sigma = sigma_;
+            for (Size i=0; i<n; ++i)
+                out[i] = average + sigma*out[i];
+        }
+    }
+
     MaddockInverseCumulativeNormal::MaddockInverseCumulativeNormal(
         long double average, long double sigma)
     : average_(average), sigma_(sigma) {}
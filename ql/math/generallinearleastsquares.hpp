@@ -55,6 +55,15 @@ namespace QuantLib {
                                   yIterator yBegin, yIterator yEnd,
                                   vIterator vBegin, vIterator vEnd);
 
+        //! regression on given values of the basis functions
+        /*! The j-th column of the design matrix holds the values of
+            the j-th basis function at the sample points, e.g., as
+            filled by a basis set without going through a vector of
+            functions.
+        */
+        template <class yContainer>
+        GeneralLinearLeastSquares(const Matrix& design, const yContainer& y);
+
         const Array& coefficients()   const { return a_; }
         const Array& residuals()      const { return residuals_; }
 
@@ -82,6 +91,9 @@ namespace QuantLib {
             xIterator xBegin, xIterator xEnd,
             yIterator yBegin, yIterator yEnd,
             vIterator vBegin, vIterator vEnd);
+
+        template <class yIterator>
+        void calculate(const Matrix& A, yIterator yBegin, yIterator yEnd);
     };
 
     template <class xContainer, class yContainer, class vContainer> inline
@@ -107,6 +119,16 @@ namespace QuantLib {
         calculate(xBegin, xEnd, yBegin, yEnd, vBegin);
     }
 
+    template <class yContainer> inline
+    GeneralLinearLeastSquares::GeneralLinearLeastSquares(const Matrix& design,
+                                                         const yContainer& y)
+    : a_(design.columns(), 0.0),
+      err_(design.columns(), 0.0),
+      residuals_(y.size()),
+      standardErrors_(design.columns()) {
+        calculate(design, y.begin(), y.end());
+    }
+
 
     template <class xIterator, class yIterator, class vIterator>
     void GeneralLinearLeastSquares::calculate(xIterator xBegin, xIterator xEnd,
@@ -116,16 +138,27 @@ namespace QuantLib {
         const Size n = residuals_.size();
         const Size m = err_.size();
 
-        QL_REQUIRE( n == Size(std::distance(yBegin, yEnd)),
+        Matrix A(n, m);
+        for (Size i=0; i<m; ++i)
+            std::transform(xBegin, xEnd, A.column_begin(i), *vBegin++);
+
+        calculate(A, yBegin, yEnd);
+    }
+
+    template <class yIterator>
+    void GeneralLinearLeastSquares::calculate(const Matrix& A,
+                                              yIterator yBegin,
+                                              yIterator yEnd) {
+
+        const Size n = residuals_.size();
+        const Size m = err_.size();
+
+        QL_REQUIRE(n == A.rows() && n == Size(std::distance(yBegin, yEnd)),
             "sample set need to be of the same size");
         QL_REQUIRE(n >= m, "sample set is too small");
 
         Size i;
 
-        Matrix A(n, m);
-        for (i=0; i<m; ++i)
-            std::transform(xBegin, xEnd, A.column_begin(i), *vBegin++);
-
         const SVD svd(A);
         const Matrix& V = svd.V();
         const Matrix& U = svd.U();
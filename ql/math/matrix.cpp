@@ -70,7 +70,187 @@ namespace {
     }
 }
 #endif
+
+#ifndef QL_USE_MKL
+namespace {
+    using QuantLib::Real;
+    using QuantLib::Size;
+
+    // register tile; MR x NR accumulators fit in the vector registers
+    const Size MR = 4, NR = 8;
+    // cache blocks: a packed MC x KC block of A stays in L2, a packed
+    // KC x NR panel of B in L1, and a packed KC x NC block of B in L3
+    const Size MC = 64, KC = 256, NC = 1024;
+
+    // copies the mc x kc block of A into MR-row panels stored column
+    // by column, padding the last panel with zeros
+    void packA(const Real* a, Size lda, Size mc, Size kc, Real* buffer) {
+        for (Size i=0; i<mc; i+=MR) {
+            const Size mr = std::min(MR, mc-i);
+            for (Size p=0; p<kc; ++p) {
+                for (Size ii=0; ii<mr; ++ii)
+                    buffer[ii] = a[(i+ii)*lda+p];
+                for (Size ii=mr; ii<MR; ++ii)
+                    buffer[ii] = 0.0;
+                buffer += MR;
+            }
+        }
+    }
+
+    // copies the kc x nc block of B into NR-column panels stored row
+    // by row, padding the last panel with zeros
+    void packB(const Real* b, Size ldb, Size kc, Size nc, Real* buffer) {
+        for (Size j=0; j<nc; j+=NR) {
+            const Size nr = std::min(NR, nc-j);
+            for (Size p=0; p<kc; ++p) {
+                const Real* row = b + p*ldb + j;
+                for (Size jj=0; jj<nr; ++jj)
+                    buffer[jj] = row[jj];
+                for (Size jj=nr; jj<NR; ++jj)
+                    buffer[jj] = 0.0;
+                buffer += NR;
+            }
+        }
+    }
+
+    // C += A B for an mr x nr tile of C, with A and B packed panels
+    void microKernel(Size kc, const Real* a, const Real* b,
+                     Real* c, Size ldc, Size mr, Size nr) {
+        Real acc[MR][NR];
+        for (Size i=0; i<MR; ++i)
+            for (Size j=0; j<NR; ++j)
+                acc[i][j] = (i < mr && j < nr) ? c[i*ldc+j] : 0.0;
+        for (Size p=0; p<kc; ++p) {
+            for (Size i=0; i<MR; ++i) {
+                const Real ai = a[i];
+                for (Size j=0; j<NR; ++j)
+                    acc[i][j] += ai*b[j];
+            }
+            a += MR;
+            b += NR;
+        }
+        for (Size i=0; i<mr; ++i)
+            for (Size j=0; j<nr; ++j)
+                c[i*ldc+j] = acc[i][j];
+    }
+
+}
+#endif
+
 namespace QuantLib {
+
+    namespace detail {
+
+        void blockedProduct(Size m, Size k, Size n,
+                            const Real* a, const Real* b, Real* c) {
+            if (m == 0 || k == 0 || n == 0)
+                return;
+#ifdef QL_USE_MKL
+            cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans,
+                        m, n, k, 1.0, a, k, b, n, 1.0, c, n);
+#else
+            const Size roundedN = ((std::min(n, NC)+NR-1)/NR)*NR;
+            const Size roundedM = ((std::min(m, MC)+MR-1)/MR)*MR;
+            std::vector<Real> packedA(roundedM*std::min(k, KC));
+            std::vector<Real> packedB(roundedN*std::min(k, KC));
+
+            for (Size jc=0; jc<n; jc+=NC) {
+                const Size nc = std::min(NC, n-jc);
+                // the k blocks are visited in order, so that each
+                // element of C accumulates its terms in natural order
+                for (Size pc=0; pc<k; pc+=KC) {
+                    const Size kc = std::min(KC, k-pc);
+                    packB(b + pc*n + jc, n, kc, nc, packedB.data());
+                    for (Size ic=0; ic<m; ic+=MC) {
+                        const Size mc = std::min(MC, m-ic);
+                        packA(a + ic*k + pc, k, mc, kc, packedA.data());
+                        for (Size jr=0; jr<nc; jr+=NR) {
+                            for (Size ir=0; ir<mc; ir+=MR) {
+                                microKernel(kc,
+                                            packedA.data() + ir*kc,
+                                            packedB.data() + jr*kc,
+                                            c + (ic+ir)*n + jc + jr, n,
+                                            std::min(MR, mc-ir),
+                                            std::min(NR, nc-jr));
+                            }
+                        }
+                    }
+                }
+            }
+#endif
+        }
+
+        void blockedProduct(Size m, Size n, const Real* a, const Real* x,
+                            Real* y) {
+#ifdef QL_USE_MKL
+            cblas_dgemv(CblasRowMajor, CblasNoTrans,
+                        m, n, 1.0, a, n, x, 1, 0.0, y, 1);
+#else
+            // four rows at a time share the loads of x and provide
+            // independent accumulation chains
+            Size i = 0;
+            for (; i+4<=m; i+=4) {
+                const Real* a0 = a + i*n;
+                const Real* a1 = a0 + n;
+                const Real* a2 = a1 + n;
+                const Real* a3 = a2 + n;
+                Real y0 = 0.0, y1 = 0.0, y2 = 0.0, y3 = 0.0;
+                for (Size j=0; j<n; ++j) {
+                    const Real xj = x[j];
+                    y0 += a0[j]*xj;
+                    y1 += a1[j]*xj;
+                    y2 += a2[j]*xj;
+                    y3 += a3[j]*xj;
+                }
+                y[i] = y0;
+                y[i+1] = y1;
+                y[i+2] = y2;
+                y[i+3] = y3;
+            }
+            for (; i<m; ++i) {
+                const Real* ai = a + i*n;
+                Real yi = 0.0;
+                for (Size j=0; j<n; ++j)
+                    yi += ai[j]*x[j];
+                y[i] = yi;
+            }
+#endif
+        }
+
+        void blockedTransposedProduct(Size m, Size n, const Real* a,
+                                      const Real* x, Real* y) {
+#ifdef QL_USE_MKL
+            cblas_dgemv(CblasRowMajor, CblasTrans,
+                        m, n, 1.0, a, n, x, 1, 0.0, y, 1);
+#else
+            // rows are accumulated in order, reading A contiguously
+            std::fill(y, y+n, 0.0);
+            for (Size i=0; i<m; ++i) {
+                const Real* ai = a + i*n;
+                const Real xi = x[i];
+                for (Size j=0; j<n; ++j)
+                    y[j] += xi*ai[j];
+            }
+#endif
+        }
+
+        void blockedTranspose(Size m, Size n, const Real* a, Real* b) {
+            // square tiles keep both the rows read and the rows
+            // written in cache
+            const Size tile = 32;
+            for (Size ib=0; ib<m; ib+=tile) {
+                const Size ie = std::min(ib+tile, m);
+                for (Size jb=0; jb<n; jb+=tile) {
+                    const Size je = std::min(jb+tile, n);
+                    for (Size i=ib; i<ie; ++i)
+                        for (Size j=jb; j<je; ++j)
+                            b[j*m+i] = a[i*n+j];
+                }
+            }
+        }
+
+    }
+
     Matrix inverse(const Matrix &m) {
         const size_t size = m.rows();
         QL_REQUIRE(size == m.columns(), "matrix is not square");
@@ -134,6 +134,9 @@ namespace QuantLib {
         bool empty() const;
         Size row_size() const;
         Size column_size() const;
+        //! get raw pointer to the row-major storage
+        Real* data() noexcept;
+        const Real* data() const noexcept;
         //@}
 
         //! \name Utilities
@@ -191,6 +194,34 @@ namespace QuantLib {
     /*! \relates Matrix */
     Real determinant(const Matrix& m);
 
+    namespace detail {
+
+        /*! Cache-blocked kernels used by the products above when the
+            operands are large enough to amortize the packing.  All
+            matrices are dense and row-major; \f$ C \f$ is accumulated
+            into, i.e., \f$ C += A B \f$ with \f$ A \f$ being
+            \f$ m \times k \f$ and \f$ B \f$ being \f$ k \times n \f$.
+            Unless MKL is used, each element of \f$ C \f$ receives its
+            terms in the same order as in the textbook loop.
+        */
+        void blockedProduct(Size m, Size k, Size n,
+                            const Real* a, const Real* b, Real* c);
+        //! \f$ y = A x \f$ with \f$ A \f$ being \f$ m \times n \f$
+        void blockedProduct(Size m, Size n, const Real* a, const Real* x,
+                            Real* y);
+        //! \f$ y = x^T A \f$ with \f$ A \f$ being \f$ m \times n \f$
+        void blockedTransposedProduct(Size m, Size n, const Real* a,
+                                      const Real* x, Real* y);
+        //! \f$ B = A^T \f$ with \f$ A \f$ being \f$ m \times n \f$
+        void blockedTranspose(Size m, Size n, const Real* a, Real* b);
+
+        // smaller operands are processed by the plain loops
+        const Size blockedProductThreshold = 32*32*32;
+        const Size blockedVectorProductThreshold = 32*32;
+        const Size blockedTransposeThreshold = 128*128;
+
+    }
+
       
     // inline definitions
 
@@ -449,6 +480,14 @@ namespace QuantLib {
         return rows_ == 0 || columns_ == 0;
     }
 
+    inline Real* Matrix::data() noexcept {
+        return data_.data();
+    }
+
+    inline const Real* Matrix::data() const noexcept {
+        return data_.data();
+    }
+
     inline Matrix operator+(const Matrix& m1,
         const Matrix& m2) {
         QL_REQUIRE(m1.rows() == m2.rows() &&
@@ -504,6 +543,11 @@ namespace QuantLib {
             << v.size() << ", " << m.rows() << "x" << m.columns() <<
             ") cannot be multiplied");
         Array result(m.columns());
+        if (m.rows()*m.columns() >= detail::blockedVectorProductThreshold) {
+            detail::blockedTransposedProduct(m.rows(), m.columns(), m.data(),
+                                             v.data(), result.data());
+            return result;
+        }
         for (Size i = 0; i < result.size(); i++)
             result[i] =
             std::inner_product(v.begin(), v.end(),
@@ -517,6 +561,11 @@ namespace QuantLib {
             << v.size() << ", " << m.rows() << "x" << m.columns() <<
             ") cannot be multiplied");
         Array result(m.rows());
+        if (m.rows()*m.columns() >= detail::blockedVectorProductThreshold) {
+            detail::blockedProduct(m.rows(), m.columns(), m.data(),
+                                   v.data(), result.data());
+            return result;
+        }
         for (Size i = 0; i < result.size(); i++)
             result[i] =
             std::inner_product(v.begin(), v.end(), m.row_begin(i), 0.0);
@@ -531,6 +580,12 @@ namespace QuantLib {
             m2.rows() << "x" << m2.columns() << ") cannot be "
             "multiplied");
         Matrix result(m1.rows(), m2.columns(), 0.0);
+        if (m1.rows()*m1.columns()*m2.columns()
+                                  >= detail::blockedProductThreshold) {
+            detail::blockedProduct(m1.rows(), m1.columns(), m2.columns(),
+                                   m1.data(), m2.data(), result.data());
+            return result;
+        }
         for (Size i = 0; i < result.rows(); ++i) {
             for (Size k = 0; k < m1.columns(); ++k) {
                 for (Size j = 0; j < result.columns(); ++j) {
@@ -543,6 +598,11 @@ namespace QuantLib {
 
     inline Matrix transpose(const Matrix& m) {
         Matrix result(m.columns(), m.rows());
+        if (m.rows()*m.columns() >= detail::blockedTransposeThreshold) {
+            detail::blockedTranspose(m.rows(), m.columns(),
+                                     m.data(), result.data());
+            return result;
+        }
         for (Size i = 0; i < m.rows(); i++)
             std::copy(m.row_begin(i), m.row_end(i), result.column_begin(i));
         return result;
@@ -95,4 +95,102 @@ namespace QuantLib {
     Real BiCGstab::norm2(const Array& a) const {
         return std::sqrt(DotProduct(a, a));
     }
+
+
+    namespace {
+
+        Real norm2(const Array& a) {
+            return std::sqrt(DotProduct(a, a));
+        }
+
+    }
+
+    InPlaceBiCGstab::InPlaceBiCGstab(InPlaceBiCGstab::MatrixMult A,
+                                     Size maxIter, Real relTol,
+                                     InPlaceBiCGstab::MatrixMult preConditioner)
+    : A_(std::move(A)), M_(std::move(preConditioner)),
+      maxIter_(maxIter), relTol_(relTol) {
+    }
+
+    Size InPlaceBiCGstab::solve(const Array& b, Array& x) {
+        QL_REQUIRE(&b != &x, "solution must not alias the right-hand side");
+        const Size n = b.size();
+
+        Real bnorm2 = norm2(b);
+        if (bnorm2 == 0.0) {
+            x = b;
+            error_ = 0.0;
+            return 0;
+        }
+
+        if (x.empty())
+            x = Array(n, 0.0);
+        QL_REQUIRE(x.size() == n, "inconsistent size of initial guess");
+        if (r_.size() != n) {
+            for (Array* a : { &r_, &rTld_, &p_, &pTld_, &v_, &s_, &sTld_, &t_ })
+                *a = Array(n);
+        }
+
+        A_(x, t_);
+        for (Size k=0; k < n; ++k)
+            r_[k] = b[k] - t_[k];
+
+        std::copy(r_.begin(), r_.end(), rTld_.begin());
+        Real omega = 1.0;
+        Real rho, rhoTld=1.0;
+        Real alpha=0.0, beta;
+        Real error=norm2(r_)/bnorm2;
+
+        Size i;
+        for (i=0; i < maxIter_ && error >= relTol_; ++i) {
+           rho = DotProduct(rTld_, r_);
+           if  (rho == 0.0 || omega == 0.0)
+               break;
+
+           if (i) {
+              beta = (rho/rhoTld)*(alpha/omega);
+              for (Size k=0; k < n; ++k)
+                  p_[k] = r_[k] + beta*(p_[k] - omega*v_[k]);
+           }
+           else {
+              std::copy(r_.begin(), r_.end(), p_.begin());
+           }
+
+           if (M_)
+               M_(p_, pTld_);
+           else
+               std::copy(p_.begin(), p_.end(), pTld_.begin());
+           A_(pTld_, v_);
+
+           alpha = rho/DotProduct(rTld_, v_);
+           for (Size k=0; k < n; ++k)
+               s_[k] = r_[k] - alpha*v_[k];
+           if (norm2(s_) < relTol_*bnorm2) {
+              for (Size k=0; k < n; ++k)
+                  x[k] += alpha*pTld_[k];
+              error = norm2(s_)/bnorm2;
+              break;
+           }
+
+           if (M_)
+               M_(s_, sTld_);
+           else
+               std::copy(s_.begin(), s_.end(), sTld_.begin());
+           A_(sTld_, t_);
+
+           omega = DotProduct(t_, s_)/DotProduct(t_, t_);
+           for (Size k=0; k < n; ++k) {
+               x[k] += alpha*pTld_[k] + omega*sTld_[k];
+               r_[k] = s_[k] - omega*t_[k];
+           }
+           error = norm2(r_)/bnorm2;
+           rhoTld = rho;
+        }
+        error_ = error;
+
+        QL_REQUIRE(i < maxIter_, "max number of iterations exceeded");
+        QL_REQUIRE(error < relTol_, "could not converge");
+
+        return i;
+    }
 }
@@ -52,6 +52,37 @@ namespace QuantLib {
         const Size maxIter_;
         const Real relTol_;  
     };
+
+    //! BiCGstab working on preallocated arrays
+    /*! Runs the same iteration as BiCGstab, but the matrix and the
+        preconditioner write their results into the given array, and
+        the work arrays are kept between calls to solve().  No
+        allocation takes place once they have been sized, which suits
+        repeated solves such as the time steps of finite-difference
+        schemes.
+    */
+    class InPlaceBiCGstab {
+      public:
+        typedef std::function<void(const Array&, Array&)> MatrixMult;
+
+        InPlaceBiCGstab(MatrixMult A, Size maxIter, Real relTol,
+                        MatrixMult preConditioner = MatrixMult());
+
+        /*! Solves A x = b, starting from the given x (or from zero if
+            x is empty) and overwriting it with the solution; x must
+            not alias b.  Returns the number of iterations.
+        */
+        Size solve(const Array& b, Array& x);
+        //! relative residual reached by the last solve
+        Real error() const { return error_; }
+
+      private:
+        const MatrixMult A_, M_;
+        const Size maxIter_;
+        const Real relTol_;
+        Real error_ = 0.0;
+        Array r_, rTld_, p_, pTld_, v_, s_, sTld_, t_;
+    };
 }
 
 #endif
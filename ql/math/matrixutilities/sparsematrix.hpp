@@ -80,6 +80,11 @@ namespace QuantLib {
             return index.first == 0 ? 0 : values_[index.second];
         }
 
+        //calls f(row, column, value) for all stored elements, row by row
+        //and with increasing columns within a row
+        template<class F>
+        void for_each_element(F f) const;
+
         //Matrix-scaler oprations
         SparseMatrixGeneral<T> &operator*=(const T &x);
 
@@ -124,6 +129,15 @@ namespace QuantLib {
         friend class element_proxy<T>;
     };
 
+    template<typename T>
+    template<class F>
+    void SparseMatrixGeneral<T>::for_each_element(F f) const {
+        for (size_t i = 0; i < filled_row_until_ - 1; ++i) {
+            for (int j = rowIndex_[i] - 1; j < rowIndex_[i + 1] - 1; ++j)
+                f(i, size_t(columns_[j] - 1), values_[j]);
+        }
+    }
+
     //Matrix-scaler oprations
     template<typename T>
     SparseMatrixGeneral<T> &SparseMatrixGeneral<T>::operator*=(const T &x) {
@@ -26,10 +26,27 @@
 #define quantlib_inversecumulative_rsg_h
 
 #include <ql/methods/montecarlo/sample.hpp>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace QuantLib {
 
+    namespace detail {
+
+        template <class IC, class = void>
+        struct has_bulk_evaluation : std::false_type {};
+
+        template <class IC>
+        struct has_bulk_evaluation<IC, std::void_t<decltype(
+            std::declval<const IC&>()(std::declval<const Real*>(),
+                                      std::declval<const Real*>(),
+                                      std::declval<Real*>()))> >
+        : std::true_type {};
+
+    }
+
     //! Inverse cumulative random sequence generator
     /*! It uses a sequence of uniform deviate in (0, 1) as the
         source of cumulative distribution values.
@@ -51,6 +68,25 @@ namespace QuantLib {
             IC::IC();
             Real IC::operator() const;
         \endcode
+
+        If IC also provides the bulk interface
+        \code
+            void IC::operator()(const Real* begin, const Real* end,
+                                Real* out) const;
+        \endcode
+        it is used to transform each sequence in a single call.
+        This is the case for InverseCumulativeNormal, whose bulk
+        version works in double precision instead of the long double
+        arithmetic of its scalar operator; the Gaussian samples
+        returned by nextSequence() can therefore differ in the last
+        bits from those obtained by transforming each value in turn.
+
+        If USG also provides
+        \code
+            void USG::nextBlock(Size count, Real* out) const;
+        \endcode
+        drawing a number of sequences into a contiguous buffer (see,
+        e.g., SobolRsg) the nextBlock() method can be used as well.
     */
     template <class USG, class IC>
     class InverseCumulativeRsg {
@@ -61,12 +97,19 @@ namespace QuantLib {
                              const IC& inverseCumulative);
         //! returns next sample from the inverse cumulative distribution
         const sample_type& nextSequence() const;
+        //! draws the next \p count samples into a contiguous buffer
+        /*! The samples are stored one after the other, as in
+            USG::nextBlock(); their weights are not returned, and
+            lastSequence() is set to the last sample of the block.
+        */
+        void nextBlock(Size count, Real* out) const;
         const sample_type& lastSequence() const { return x_; }
         Size dimension() const { return dimension_; }
       private:
         USG uniformSequenceGenerator_;
         Size dimension_;
         mutable sample_type x_;
+        mutable std::vector<Real> uniforms_;
         IC ICD_;
     };
 
@@ -87,15 +130,39 @@ namespace QuantLib {
     template <class USG, class IC>
     inline const typename InverseCumulativeRsg<USG, IC>::sample_type&
     InverseCumulativeRsg<USG, IC>::nextSequence() const {
-        typename USG::sample_type sample =
+        const typename USG::sample_type& sample =
             uniformSequenceGenerator_.nextSequence();
         x_.weight = sample.weight;
-        for (Size i = 0; i < dimension_; i++) {
-            x_.value[i] = ICD_(sample.value[i]);
+        if constexpr (detail::has_bulk_evaluation<IC>::value) {
+            const Real* begin = &sample.value[0];
+            ICD_(begin, begin + dimension_, &x_.value[0]);
+        } else {
+            for (Size i = 0; i < dimension_; i++) {
+                x_.value[i] = ICD_(sample.value[i]);
+            }
         }
         return x_;
     }
 
+    template <class USG, class IC>
+    inline void InverseCumulativeRsg<USG, IC>::nextBlock(Size count,
+                                                         Real* out) const {
+        if (count == 0)
+            return;
+        const Size n = count*dimension_;
+        // the bulk evaluation doesn't work in place
+        uniforms_.resize(n);
+        uniformSequenceGenerator_.nextBlock(count, uniforms_.data());
+        if constexpr (detail::has_bulk_evaluation<IC>::value) {
+            ICD_(uniforms_.data(), uniforms_.data() + n, out);
+        } else {
+            for (Size i = 0; i < n; i++)
+                out[i] = ICD_(uniforms_[i]);
+        }
+        std::copy(out + n - dimension_, out + n, x_.value.begin());
+        x_.weight = 1.0;
+    }
+
 }
 
 
@@ -0,0 +1,95 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/math/randomnumbers/philoxuniformrng.hpp>
+#include <ql/math/randomnumbers/seedgenerator.hpp>
+
+namespace QuantLib {
+
+    namespace {
+
+        // multipliers and Weyl sequence increments of Philox-4x32
+        const std::uint32_t M0 = 0xD2511F53U, M1 = 0xCD9E8D57U;
+        const std::uint32_t W0 = 0x9E3779B9U, W1 = 0xBB67AE85U;
+
+        PhiloxUniformRng::counter_type counter(std::uint64_t block,
+                                               std::uint64_t stream) {
+            return {{ std::uint32_t(block), std::uint32_t(block >> 32),
+                      std::uint32_t(stream), std::uint32_t(stream >> 32) }};
+        }
+
+        Real toReal(std::uint32_t x) {
+            return (Real(x) + 0.5)/4294967296.0;
+        }
+
+    }
+
+    PhiloxUniformRng::PhiloxUniformRng(unsigned long seed,
+                                       unsigned long stream)
+    : stream_(stream), counter_(0), buffer_(), index_(4) {
+        std::uint64_t s = (seed != 0 ? seed : SeedGenerator::instance().get());
+        key_ = {{ std::uint32_t(s), std::uint32_t(s >> 32) }};
+    }
+
+    PhiloxUniformRng::counter_type
+    PhiloxUniformRng::philox(counter_type x, key_type key) {
+        for (Size round=0; round<10; ++round) {
+            if (round > 0) {
+                key[0] += W0;
+                key[1] += W1;
+            }
+            std::uint64_t p0 = std::uint64_t(M0) * x[0];
+            std::uint64_t p1 = std::uint64_t(M1) * x[2];
+            x = {{ std::uint32_t(p1 >> 32) ^ x[1] ^ key[0],
+                   std::uint32_t(p1),
+                   std::uint32_t(p0 >> 32) ^ x[3] ^ key[1],
+                   std::uint32_t(p0) }};
+        }
+        return x;
+    }
+
+    void PhiloxUniformRng::generate() const {
+        buffer_ = philox(counter(counter_++, stream_), key_);
+        index_ = 0;
+    }
+
+    void PhiloxUniformRng::skipTo(unsigned long long n) {
+        counter_ = n / 4;
+        generate();
+        index_ = n % 4;
+    }
+
+    void PhiloxUniformRng::next(Size n, Real* out) const {
+        Size i = 0;
+        // numbers left from the last block...
+        while (i < n && index_ < 4)
+            out[i++] = toReal(buffer_[index_++]);
+        // ...whole blocks...
+        for (; i+4 <= n; i += 4) {
+            counter_type x = philox(counter(counter_++, stream_), key_);
+            for (Size k=0; k<4; ++k)
+                out[i+k] = toReal(x[k]);
+        }
+        // ...and the first numbers of the next one
+        if (i < n) {
+            generate();
+            while (i < n)
+                out[i++] = toReal(buffer_[index_++]);
+        }
+    }
+
+}
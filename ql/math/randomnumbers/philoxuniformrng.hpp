@@ -0,0 +1,103 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file philoxuniformrng.hpp
+    \brief Philox counter-based uniform random number generator
+*/
+
+#ifndef quantlib_philox_uniform_rng_hpp
+#define quantlib_philox_uniform_rng_hpp
+
+#include <ql/methods/montecarlo/sample.hpp>
+#include <array>
+#include <cstdint>
+
+namespace QuantLib {
+
+    //! Counter-based uniform random number generator
+    /*! Philox-4x32-10 generator by Salmon, Moraes, Dror and Shaw.
+        The \f$ n \f$-th number of a stream is obtained by applying a
+        keyed bijection to a counter made of the stream index and of
+        \f$ n/4 \f$; the seed is used as the key.  Therefore:
+        - any number of a stream can be obtained in constant time by
+          means of skipTo(), so that a stream can be split among
+          threads or processes in any way while drawing the same
+          numbers;
+        - the \f$ 2^{64} \f$ streams available for each seed are
+          statistically independent and don't require any seeding
+          scheme.
+
+        See J.K. Salmon, M.A. Moraes, R.O. Dror and D.E. Shaw,
+        "Parallel random numbers: as easy as 1, 2, 3", Proceedings of
+        the International Conference for High Performance Computing,
+        Networking, Storage and Analysis (SC11), 2011.
+
+        \test the correctness of the returned values is tested by
+              checking them against known good results.
+    */
+    class PhiloxUniformRng {
+      public:
+        typedef Sample<Real> sample_type;
+        typedef unsigned long result_type;
+        typedef std::array<std::uint32_t, 4> counter_type;
+        typedef std::array<std::uint32_t, 2> key_type;
+        /*! if the given seed is 0, a random seed will be chosen
+            based on clock() */
+        explicit PhiloxUniformRng(unsigned long seed = 0,
+                                  unsigned long stream = 0);
+        /*! returns a sample with weight 1.0 containing a random number
+            in the (0.0, 1.0) interval  */
+        sample_type next() const { return sample_type(nextReal(),1.0); }
+        //! writes the next \p n random numbers in (0.0, 1.0) to \p out
+        /*! This draws the same numbers as \p n calls to nextReal(). */
+        void next(Size n, Real* out) const;
+        //! return a random number in the (0.0, 1.0)-interval
+        Real nextReal() const {
+            return (Real(nextInt32()) + 0.5)/4294967296.0;
+        }
+        //! return a random integer in the [0,0xffffffff]-interval
+        unsigned long nextInt32() const {
+            if (index_ == 4)
+                generate();
+            return buffer_[index_++];
+        }
+        //! skip to the n-th number of the stream
+        void skipTo(unsigned long long n);
+        unsigned long operator()() const {
+            return nextInt32();
+        }
+        static constexpr unsigned long max() {
+            return 0xffffffff;
+        }
+        static constexpr unsigned long min() {
+            return 0;
+        }
+        //! the Philox-4x32-10 bijection
+        static counter_type philox(counter_type counter, key_type key);
+      private:
+        void generate() const;
+        key_type key_;
+        std::uint64_t stream_;
+        mutable std::uint64_t counter_;
+        mutable counter_type buffer_;
+        mutable Size index_;
+    };
+
+}
+
+
+#endif
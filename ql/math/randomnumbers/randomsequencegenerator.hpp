@@ -26,6 +26,8 @@
 
 #include <ql/methods/montecarlo/sample.hpp>
 #include <ql/errors.hpp>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace QuantLib {
@@ -44,8 +46,32 @@ namespace QuantLib {
             unsigned long RNG::nextInt32() const;
         \endcode
 
+        If RNG also provides the batch interface
+        \code
+            void RNG::next(Size n, Real* out) const;
+        \endcode
+        drawing \p n numbers with unit weight, it is used to fill each
+        sequence in a single call; if it provides
+        \code
+            void RNG::skipTo(unsigned long long n);
+        \endcode
+        the skipTo method can be used as well.
+
         \warning do not use with low-discrepancy sequence generator.
     */
+    namespace detail {
+
+        template <class RNG, class = void>
+        struct has_batch_generation : std::false_type {};
+
+        template <class RNG>
+        struct has_batch_generation<RNG, std::void_t<decltype(
+            std::declval<const RNG&>().next(std::declval<Size>(),
+                                            std::declval<Real*>()))> >
+        : std::true_type {};
+
+    }
+
     template<class RNG>
     class RandomSequenceGenerator {
       public:
@@ -67,10 +93,14 @@ namespace QuantLib {
 
         const sample_type& nextSequence() const {
             sequence_.weight = 1.0;
-            for (Size i=0; i<dimensionality_; i++) {
-                typename RNG::sample_type x(rng_.next());
-                sequence_.value[i] = x.value;
-                sequence_.weight  *= x.weight;
+            if constexpr (detail::has_batch_generation<RNG>::value) {
+                rng_.next(dimensionality_, &sequence_.value[0]);
+            } else {
+                for (Size i=0; i<dimensionality_; i++) {
+                    typename RNG::sample_type x(rng_.next());
+                    sequence_.value[i] = x.value;
+                    sequence_.weight  *= x.weight;
+                }
             }
             return sequence_;
         }
@@ -83,6 +113,10 @@ namespace QuantLib {
         const sample_type& lastSequence() const {
             return sequence_;
         }
+        //! skip to the n-th sequence
+        void skipTo(unsigned long long n) {
+            rng_.skipTo(n*dimensionality_);
+        }
         Size dimension() const {return dimensionality_;}
       private:
         Size dimensionality_;
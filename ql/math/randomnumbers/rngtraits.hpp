@@ -28,15 +28,46 @@
 
 #include <ql/methods/montecarlo/pathgenerator.hpp>
 #include <ql/math/randomnumbers/mt19937uniformrng.hpp>
+#include <ql/math/randomnumbers/philoxuniformrng.hpp>
 #include <ql/math/randomnumbers/inversecumulativerng.hpp>
 #include <ql/math/randomnumbers/randomsequencegenerator.hpp>
 #include <ql/math/randomnumbers/sobolrsg.hpp>
+#include <ql/math/randomnumbers/zigguratrng.hpp>
 #include <ql/math/randomnumbers/inversecumulativersg.hpp>
 #include <ql/math/distributions/normaldistribution.hpp>
 #include <ql/math/distributions/poissondistribution.hpp>
+#include <ql/utilities/null.hpp>
 
 namespace QuantLib {
 
+    namespace detail {
+
+        /* seed of the i-th of a set of pseudo-random streams; a null
+           seed is left alone so that each stream gets a random one */
+        inline BigNatural streamSeed(BigNatural seed, Size stream) {
+            if (seed == 0)
+                return 0;
+            MersenneTwisterUniformRng seeder(seed);
+            BigNatural result = 0;
+            for (Size i=0; i<=stream || result == 0; ++i)
+                result = seeder.nextInt32();
+            return result;
+        }
+
+        // counter-based generators can be built for a given stream
+        // and moved to any sample in constant time
+        template <class URNG, class = void>
+        struct is_counter_based : std::false_type {};
+
+        template <class URNG>
+        struct is_counter_based<URNG, std::void_t<
+            decltype(URNG(std::declval<BigNatural>(), std::declval<Size>())),
+            decltype(std::declval<URNG&>().skipTo(
+                                   std::declval<unsigned long long>()))> >
+        : std::true_type {};
+
+    }
+
     // random number traits
 
     template <class URNG, class IC>
@@ -54,6 +85,42 @@ namespace QuantLib {
             ursg_type g(dimension, seed);
             return (icInstance ? rsg_type(g, *icInstance) : rsg_type(g));
         }
+        //! factory for the generator of one of a set of threads
+        /*! In a simulation with a fixed number of samples, \p
+            firstSample is the index of the first sample drawn by the
+            thread; in an open-ended one, e.g., a simulation running
+            until a given tolerance is reached, it is Null<Size>().
+
+            Counter-based generators such as PhiloxUniformRng draw a
+            fixed number of samples from a single stream, skipping the
+            first \p firstSample sequences, so that the samples don't
+            depend on how they are split among threads; in open-ended
+            simulations, each thread draws from the independent stream
+            of the generator with the given index.
+
+            For other generators, the seed of each stream is drawn from
+            a Mersenne-Twister generator initialized with the given
+            seed, so that streams are reproducible; the index of the
+            first sample is not used.
+        */
+        static rsg_type make_sequence_generator(Size dimension,
+                                                BigNatural seed,
+                                                Size stream,
+                                                Size firstSample) {
+            if constexpr (detail::is_counter_based<URNG>::value) {
+                if (firstSample == Null<Size>()) {
+                    ursg_type g(dimension, urng_type(seed, stream));
+                    return (icInstance ? rsg_type(g, *icInstance)
+                                       : rsg_type(g));
+                }
+                ursg_type g(dimension, urng_type(seed, 0));
+                g.skipTo(firstSample);
+                return (icInstance ? rsg_type(g, *icInstance) : rsg_type(g));
+            } else {
+                return make_sequence_generator(
+                            dimension, detail::streamSeed(seed, stream));
+            }
+        }
         // data
         static std::shared_ptr<IC> icInstance;
     };
@@ -77,6 +144,46 @@ namespace QuantLib {
     typedef GenericPseudoRandom<MersenneTwisterUniformRng,
                                 InverseCumulativePoisson> PoissonPseudoRandom;
 
+    //! traits for counter-based pseudo-random number generation
+    /*! Multi-threaded simulations with a fixed number of samples
+        split a single stream among threads, so that their results
+        don't depend on the number of threads; open-ended simulations
+        give each thread an independent stream of the same generator
+        instead of a differently seeded one.
+    */
+    typedef GenericPseudoRandom<PhiloxUniformRng,
+                                InverseCumulativeNormal> PhiloxPseudoRandom;
+
+
+    //! traits for Gaussian pseudo-random number generation by Ziggurat
+    /*! The Gaussian variates are drawn directly by ZigguratRng,
+        without transforming uniform ones; each sequence is filled by
+        a single call to the generator.  The resulting traits can be
+        used in place of PseudoRandom.
+    */
+    struct Ziggurat {
+        // typedefs
+        typedef ZigguratRng rng_type;
+        typedef RandomSequenceGenerator<rng_type> rsg_type;
+        // more traits
+        enum { allowsErrorEstimate = 1 };
+        // factory
+        static rsg_type make_sequence_generator(Size dimension,
+                                                BigNatural seed) {
+            return rsg_type(dimension, seed);
+        }
+        //! factory for the generator of one of a set of threads
+        /*! The streams are seeded as for GenericPseudoRandom; the
+            index of the first sample is not used.
+        */
+        static rsg_type make_sequence_generator(Size dimension,
+                                                BigNatural seed,
+                                                Size stream,
+                                                Size firstSample) {
+            return rsg_type(dimension, detail::streamSeed(seed, stream));
+        }
+    };
+
 
     template <class URSG, class IC>
     struct GenericLowDiscrepancy {
@@ -91,6 +198,23 @@ namespace QuantLib {
             ursg_type g(dimension, seed);
             return (icInstance ? rsg_type(g, *icInstance) : rsg_type(g));
         }
+        //! factory for the generator of one of a set of threads
+        /*! Threads draw contiguous blocks of the same sequence; the
+            returned generator skips the first \p firstSample points.
+            The stream index is not used, and the number of samples
+            must be fixed.
+        */
+        static rsg_type make_sequence_generator(Size dimension,
+                                                BigNatural seed,
+                                                Size stream,
+                                                Size firstSample) {
+            QL_REQUIRE(firstSample != Null<Size>(),
+                       "low-discrepancy sequences can only be split "
+                       "for a fixed number of samples");
+            ursg_type g(dimension, seed);
+            g.skipTo(firstSample);
+            return (icInstance ? rsg_type(g, *icInstance) : rsg_type(g));
+        }
         // data
         static std::shared_ptr<IC> icInstance;
     };
@@ -38,7 +38,8 @@ namespace QuantLib {
                                    = SobolBrownianGenerator::Diagonal,
                                unsigned long seed = 0,
                                SobolRsg::DirectionIntegers directionIntegers
-                                   = SobolRsg::JoeKuoD7);
+                                   = SobolRsg::JoeKuoD7,
+                               Size batchSize = 1);
 
         const sample_type& nextSequence() const;
         const sample_type& lastSequence() const;
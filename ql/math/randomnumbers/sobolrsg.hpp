@@ -27,6 +27,7 @@
 #define quantlib_sobol_ld_rsg_hpp
 
 #include <ql/methods/montecarlo/sample.hpp>
+#include <algorithm>
 #include <vector>
 
 namespace QuantLib {
@@ -117,7 +118,13 @@ namespace QuantLib {
         SobolRsg(Size dimensionality,
                  unsigned long seed = 0,
                  DirectionIntegers directionIntegers = Jaeckel);
-        /*! skip to the n-th sample in the low-discrepancy sequence */
+        /*! skip to the n-th sample in the low-discrepancy sequence.
+
+            The point is obtained in closed form from the Gray code of
+            \f$ n \f$, without drawing the previous ones; together
+            with nextBlock(), this allows to split the sequence into
+            contiguous chunks drawn by different threads or processes.
+        */
         void skipTo(unsigned long n);
         const std::vector<unsigned long>& nextInt32Sequence() const;
         const SobolRsg::sample_type& nextSequence() const {
@@ -127,6 +134,13 @@ namespace QuantLib {
                 sequence_.value[k] = v[k] * normalizationFactor_;
             return sequence_;
         }
+        //! draws the next \p count points into a contiguous buffer
+        /*! The points are stored one after the other, i.e., the
+            \f$ k \f$-th coordinate of the \f$ i \f$-th point is
+            written to <tt>out[i*dimension()+k]</tt>.  Afterwards,
+            lastSequence() returns the last point of the block.
+        */
+        void nextBlock(Size count, Real* out) const;
         const sample_type& lastSequence() const { return sequence_; }
         Size dimension() const { return dimensionality_; }
       private:
@@ -140,6 +154,19 @@ namespace QuantLib {
         std::vector<std::vector<unsigned long> > directionIntegers_;
     };
 
+
+    // inline definitions
+
+    inline void SobolRsg::nextBlock(Size count, Real* out) const {
+        for (Size i=0; i<count; ++i, out += dimensionality_) {
+            const std::vector<unsigned long>& v = nextInt32Sequence();
+            for (Size k=0; k<dimensionality_; ++k)
+                out[k] = v[k] * normalizationFactor_;
+        }
+        if (count > 0)
+            std::copy(out - dimensionality_, out, sequence_.value.begin());
+    }
+
 }
 
 #endif
@@ -17,7 +17,7 @@
  FOR A PARTICULAR PURPOSE.  See the license for more details.
 */
 
-#include <ql/experimental/math/zigguratrng.hpp>
+#include <ql/math/randomnumbers/zigguratrng.hpp>
 #include <ql/math/distributions/normaldistribution.hpp>
 #include <cmath>
 
@@ -238,4 +238,9 @@ namespace QuantLib {
         return x;
     }
 
+    void ZigguratRng::next(Size n, Real* out) const {
+        for (Size i=0; i<n; ++i)
+            out[i] = nextGaussian();
+    }
+
 }
@@ -297,6 +297,15 @@ namespace QuantLib {
                 add(*begin, *wbegin);
         }
 
+        //! adds the data collected by another instance
+        void merge(const GeneralStatistics& other) {
+            QL_REQUIRE(&other != this,
+                       "statistics can't be merged with themselves");
+            samples_.insert(samples_.end(),
+                            other.samples_.begin(), other.samples_.end());
+            sorted_ = false;
+        }
+
         //! resets the data to a null set
         void reset() {
             samples_ = std::vector<std::pair<Real, Real> >();
@@ -130,6 +130,14 @@ namespace QuantLib {
             downsideData_.emplace_back(std::make_pair(value, valueWeight));
     }
 
+    void IncrementalStatistics::merge(const IncrementalStatistics& other) {
+        QL_REQUIRE(&other != this, "statistics can't be merged with themselves");
+        data_.insert(data_.end(), other.data_.begin(), other.data_.end());
+        downsideData_.insert(downsideData_.end(),
+                             other.downsideData_.begin(),
+                             other.downsideData_.end());
+    }
+
     void IncrementalStatistics::reset() {
         data_.clear();
         downsideData_.clear();
@@ -134,6 +134,9 @@ namespace QuantLib {
                 add(*begin, *wbegin);
         }
 
+        //! adds the data collected by another instance
+        void merge(const IncrementalStatistics& other);
+
         //! resets the data to a null set
         void reset();
         //@}
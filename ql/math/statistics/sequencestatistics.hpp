@@ -139,6 +139,12 @@ namespace QuantLib {
                 stats_[i].add(*begin, weight);
 
         }
+        //! adds the samples collected by another instance
+        /*! The result is the same as adding the samples of \p other
+            after those already collected, up to rounding in the
+            covariance.
+        */
+        void merge(const GenericSequenceStatistics& other);
         //@}
       protected:
         Size dimension_;
@@ -244,6 +250,23 @@ namespace QuantLib {
         }
     }
 
+    template <class Stat>
+    void GenericSequenceStatistics<Stat>::merge(
+                                     const GenericSequenceStatistics& other) {
+        if (other.dimension_ == 0)
+            return;
+        if (dimension_ == 0)
+            reset(other.dimension_);
+
+        QL_REQUIRE(other.dimension_ == dimension_,
+                   "sample size mismatch: " << dimension_ <<
+                   " required, " << other.dimension_ << " provided");
+
+        quadraticSum_ += other.quadraticSum_;
+        for (Size i=0; i<dimension_; ++i)
+            stats_[i].merge(other.stats_[i]);
+    }
+
     template <class Stat>
     Matrix GenericSequenceStatistics<Stat>::covariance() const {
         Real sampleWeight = weightSum();
@@ -36,7 +36,8 @@ namespace QuantLib {
             const std::shared_ptr<GeneralizedBlackScholesProcess>& process,
             Time maturity, const std::vector<Real>& strikes,
             Real eps, Real scaleFactor,
-            const std::pair<Real, Real>& cPoint)
+            const std::pair<Real, Real>& cPoint,
+            const DividendSchedule& dividendSchedule)
     : Fdm1dMesher(size) {
 
         const Real spot = process->x0();
@@ -61,10 +62,25 @@ namespace QuantLib {
             = process->blackVolatility()->blackVol(maturity, maxStrike)
                                                         *std::sqrt(maturity);
         
+        // the dividends paid until maturity lower the forward at
+        // maturity by a fraction dividends/spot
+        Real dividends = 0.0;
+        for (const auto& dividend : dividendSchedule) {
+            const Time t = process->time(dividend->date());
+            if (t >= 0.0 && t <= maturity)
+                dividends += dividend->amount(spot)
+                    * process->riskFreeRate()->discount(t)
+                    / process->dividendYield()->discount(t);
+        }
+        QL_REQUIRE(dividends < spot,
+                   "dividends exceed the value of the underlying");
+        const Real dividendShift = std::log(1.0 - dividends/spot);
+
         const Real xMin
             = std::min(0.8*std::log(0.8*spot*spot/maxStrike),
                        std::log(Fmin) - sigmaSqrtTmin*normInvEps*scaleFactor
-                                      - sigmaSqrtTmin*sigmaSqrtTmin/2.0);
+                                      - sigmaSqrtTmin*sigmaSqrtTmin/2.0)
+              + dividendShift;
         const Real xMax
             = std::max(1.2*std::log(0.8*spot*spot/minStrike),
                        std::log(Fmax) + sigmaSqrtTmax*normInvEps*scaleFactor
@@ -34,6 +34,9 @@ namespace QuantLib {
     class YieldTermStructure;
     class GeneralizedBlackScholesProcess;
 
+    /*! Discrete dividends paid before maturity extend the grid
+        downwards by the corresponding drop of the underlying.
+    */
     class FdmBlackScholesMultiStrikeMesher : public Fdm1dMesher {
       public:
         FdmBlackScholesMultiStrikeMesher(
@@ -43,7 +46,8 @@ namespace QuantLib {
             Real eps = 0.0001,
             Real scaleFactor = 1.5,
             const std::pair<Real, Real>& cPoint
-                        = (std::pair<Real, Real>(Null<Real>(), Null<Real>())));
+                        = (std::pair<Real, Real>(Null<Real>(), Null<Real>())),
+            const DividendSchedule& dividendSchedule = DividendSchedule());
 
         static std::shared_ptr<GeneralizedBlackScholesProcess> processHelper(
              const Handle<Quote>& s0,
@@ -120,11 +120,12 @@ namespace QuantLib {
     Array FdmMesherComposite::locations(Size direction) const {
         Array retVal(layout_->size());
 
-        const FdmLinearOpIterator endIter = layout_->end();
-        for (FdmLinearOpIterator iter = layout_->begin();
-             iter != endIter; ++iter) {
-            retVal[iter.index()] =
-                mesher_[direction]->locations()[iter.coordinates()[direction]];
+        const std::vector<Real>& x = mesher_[direction]->locations();
+        const Size stride = layout_->spacing()[direction];
+        for (Size l=0; l < layout_->lines(direction); ++l) {
+            Size i = layout_->lineStart(direction, l);
+            for (Size c=0; c < x.size(); ++c, i+=stride)
+                retVal[i] = x[c];
         }
 
         return retVal;
@@ -25,6 +25,9 @@
 #include <ql/methods/finitedifferences/operators/fdmlinearoplayout.hpp>
 #include <ql/methods/finitedifferences/operators/fdmblackscholesop.hpp>
 #include <ql/methods/finitedifferences/operators/secondderivativeop.hpp>
+#include <ql/methods/finitedifferences/utilities/fdmconstantforward.hpp>
+#include <ql/termstructures/volatility/equityfx/blackconstantvol.hpp>
+
 namespace QuantLib {
 
     FdmBlackScholesOp::FdmBlackScholesOp(
@@ -46,10 +49,22 @@ namespace QuantLib {
       mapT_  (direction, mesher),
       strike_(strike),
       illegalLocalVolOverwrite_(illegalLocalVolOverwrite),
-      direction_(direction) {
+      direction_(direction),
+      timeHomogeneous_(
+          !localVol
+          && fdmHasConstantForward(rTS_)
+          && fdmHasConstantForward(qTS_)
+          && std::dynamic_pointer_cast<BlackConstantVol>(volTS_) != nullptr) {
     }
 
     void FdmBlackScholesOp::setTime(Time t1, Time t2) {
+        // with constant forward rates and volatility the bands don't
+        // depend on time; keeping them also keeps the factorization
+        // cached by mapT_
+        if (timeHomogeneous_ && initialized_)
+            return;
+        initialized_ = true;
+
         const Rate r = rTS_->forwardRate(t1, t2, Continuous).rate();
         const Rate q = qTS_->forwardRate(t1, t2, Continuous).rate();
 
@@ -82,9 +97,7 @@ namespace QuantLib {
         else {
             const Real v
                 = volTS_->blackForwardVariance(t1, t2, strike_)/(t2-t1);
-            mapT_.axpyb(Array(1, r - q - 0.5*v), dxMap_,
-                        dxxMap_.mult(0.5*Array(mesher_->layout()->size(), v)),
-                        Array(1, -r));
+            mapT_.axpbyc(r - q - 0.5*v, dxMap_, 0.5*v, dxxMap_, -r);
         }
     }
 
@@ -126,6 +139,41 @@ namespace QuantLib {
         return solve_splitting(direction_, r, dt);
     }
 
+    void FdmBlackScholesOp::apply_into(const Array& r, Array& result) const {
+        mapT_.apply_into(r, result);
+    }
+
+    void FdmBlackScholesOp::apply_direction_into(
+        Size direction, const Array& r, Array& result) const {
+        if (direction == direction_)
+            mapT_.apply_into(r, result);
+        else {
+            if (result.size() != r.size())
+                result = Array(r.size());
+            std::fill(result.begin(), result.end(), 0.0);
+        }
+    }
+
+    void FdmBlackScholesOp::apply_mixed_into(const Array& r,
+                                             Array& result) const {
+        if (result.size() != r.size())
+            result = Array(r.size());
+        std::fill(result.begin(), result.end(), 0.0);
+    }
+
+    void FdmBlackScholesOp::solve_splitting_into(
+        Size direction, const Array& r, Real dt, Array& result) const {
+        if (direction == direction_)
+            mapT_.solve_splitting_into(r, dt, 1.0, result);
+        else if (&r != &result)
+            result = r;
+    }
+
+    void FdmBlackScholesOp::preconditioner_into(
+        const Array& r, Real dt, Array& result) const {
+        solve_splitting_into(direction_, r, dt, result);
+    }
+
     std::vector<SparseMatrix> 
     FdmBlackScholesOp::toMatrixDecomp() const {
         std::vector<SparseMatrix> retVal(1, mapT_.toMatrix());
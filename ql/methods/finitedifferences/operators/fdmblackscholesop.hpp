@@ -55,6 +55,15 @@ namespace QuantLib {
                                           const Array& r, Real s) const;
         Array preconditioner(const Array& r, Real s) const;
 
+        void apply_into(const Array& r, Array& result) const;
+        void apply_mixed_into(const Array& r, Array& result) const;
+        void apply_direction_into(Size direction, const Array& r,
+                                  Array& result) const;
+        void solve_splitting_into(Size direction, const Array& r, Real s,
+                                  Array& result) const;
+        void preconditioner_into(const Array& r, Real s,
+                                 Array& result) const;
+
         std::vector<SparseMatrix>  toMatrixDecomp() const;
       private:
         const std::shared_ptr<FdmMesher> mesher_;
@@ -68,6 +77,9 @@ namespace QuantLib {
         const Real strike_;
         const Real illegalLocalVolOverwrite_;
         const Size direction_;
+        // constant coefficients, set only once by setTime
+        const bool timeHomogeneous_;
+        bool initialized_ = false;
     };
 }
 
@@ -113,6 +113,49 @@ namespace QuantLib {
         return solve_splitting(direction1_, r, dt);
     }
 
+    void FdmG2Op::apply_into(const Array& r, Array& result) const {
+        mapX_.apply_into(r, result, pool_.get());
+        mapY_.apply_into(r, work_, pool_.get());
+        result += work_;
+        apply_mixed_into(r, work_);
+        result += work_;
+    }
+
+    void FdmG2Op::apply_mixed_into(const Array& r, Array& result) const {
+        corrMap_.apply_into(r, result, pool_.get());
+    }
+
+    void FdmG2Op::apply_direction_into(
+        Size direction, const Array& r, Array& result) const {
+        if (direction == direction1_)
+            mapX_.apply_into(r, result, pool_.get());
+        else if (direction == direction2_)
+            mapY_.apply_into(r, result, pool_.get());
+        else {
+            if (result.size() != r.size())
+                result = Array(r.size());
+            std::fill(result.begin(), result.end(), 0.0);
+        }
+    }
+
+    void FdmG2Op::solve_splitting_into(
+        Size direction, const Array& r, Real a, Array& result) const {
+        if (direction == direction1_)
+            mapX_.solve_splitting_into(r, a, 1.0, result, pool_.get());
+        else if (direction == direction2_)
+            mapY_.solve_splitting_into(r, a, 1.0, result, pool_.get());
+        else {
+            if (result.size() != r.size())
+                result = Array(r.size());
+            std::fill(result.begin(), result.end(), 0.0);
+        }
+    }
+
+    void FdmG2Op::preconditioner_into(
+        const Array& r, Real dt, Array& result) const {
+        solve_splitting_into(direction1_, r, dt, result);
+    }
+
     std::vector<SparseMatrix>  FdmG2Op::toMatrixDecomp() const {
         std::vector<SparseMatrix> retVal(3);
         retVal[0] = mapX_.toMatrix();
@@ -51,6 +51,15 @@ namespace QuantLib {
             solve_splitting(Size direction, const Array& r, Real s) const;
         Array preconditioner(const Array& r, Real s) const;
 
+        void apply_into(const Array& r, Array& result) const;
+        void apply_mixed_into(const Array& r, Array& result) const;
+        void apply_direction_into(Size direction, const Array& r,
+                                  Array& result) const;
+        void solve_splitting_into(Size direction, const Array& r, Real s,
+                                  Array& result) const;
+        void preconditioner_into(const Array& r, Real s,
+                                 Array& result) const;
+
         std::vector<SparseMatrix>  toMatrixDecomp() const;
       private:
         const Size direction1_, direction2_;
@@ -61,6 +70,7 @@ namespace QuantLib {
         TripleBandLinearOp mapX_, mapY_;
 
         const std::shared_ptr<G2> model_;
+        mutable Array work_;
     };
 }
 
@@ -156,6 +156,62 @@ namespace QuantLib {
         return solve_splitting(0, r, dt);
     }
 
+    void FdmHestonHullWhiteOp::apply_into(const Array& u,
+                                          Array& result) const {
+        dyMap_.apply_into(u, result, pool_.get());
+        dxMap_.getMap().apply_into(u, work_, pool_.get());
+        result += work_;
+        hullWhiteOp_.apply_into(u, work_);
+        result += work_;
+        hestonCorrMap_.apply_into(u, work_, pool_.get());
+        result += work_;
+        equityIrCorrMap_.apply_into(u, work_, pool_.get());
+        result += work_;
+    }
+
+    void FdmHestonHullWhiteOp::apply_mixed_into(const Array& r,
+                                                Array& result) const {
+        hestonCorrMap_.apply_into(r, result, pool_.get());
+        equityIrCorrMap_.apply_into(r, work_, pool_.get());
+        result += work_;
+    }
+
+    void FdmHestonHullWhiteOp::apply_direction_into(
+        Size direction, const Array& r, Array& result) const {
+        if (direction == 0)
+            dxMap_.getMap().apply_into(r, result, pool_.get());
+        else if (direction == 1)
+            dyMap_.apply_into(r, result, pool_.get());
+        else if (direction == 2)
+            hullWhiteOp_.apply_into(r, result);
+        else
+            QL_FAIL("direction too large");
+    }
+
+    void FdmHestonHullWhiteOp::solve_splitting_into(
+        Size direction, const Array& r, Real a, Array& result) const {
+        if (direction == 0)
+            dxMap_.getMap().solve_splitting_into(r, a, 1.0, result,
+                                                pool_.get());
+        else if (direction == 1)
+            dyMap_.solve_splitting_into(r, a, 1.0, result, pool_.get());
+        else if (direction == 2)
+            hullWhiteOp_.solve_splitting_into(2, r, a, result);
+        else
+            QL_FAIL("direction too large");
+    }
+
+    void FdmHestonHullWhiteOp::preconditioner_into(
+        const Array& r, Real dt, Array& result) const {
+        solve_splitting_into(0, r, dt, result);
+    }
+
+    void FdmHestonHullWhiteOp::setThreadPool(
+                                        std::shared_ptr<ThreadPool> pool) {
+        hullWhiteOp_.setThreadPool(pool);
+        FdmLinearOpComposite::setThreadPool(std::move(pool));
+    }
+
     std::vector<SparseMatrix> 
     FdmHestonHullWhiteOp::toMatrixDecomp() const {
         std::vector<SparseMatrix> retVal(4);
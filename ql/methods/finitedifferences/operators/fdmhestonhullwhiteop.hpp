@@ -80,6 +80,17 @@ namespace QuantLib {
                                           const Array& r, Real s) const;
         Array preconditioner(const Array& r, Real s) const;
 
+        void apply_into(const Array& r, Array& result) const;
+        void apply_mixed_into(const Array& r, Array& result) const;
+        void apply_direction_into(Size direction, const Array& r,
+                                  Array& result) const;
+        void solve_splitting_into(Size direction, const Array& r, Real s,
+                                  Array& result) const;
+        void preconditioner_into(const Array& r, Real s,
+                                 Array& result) const;
+
+        void setThreadPool(std::shared_ptr<ThreadPool> pool);
+
         std::vector<SparseMatrix>  toMatrixDecomp() const;
       private:
         const Real v0_, kappa_, theta_, sigma_, rho_;
@@ -90,6 +101,7 @@ namespace QuantLib {
         TripleBandLinearOp dyMap_;
         FdmHestonHullWhiteEquityPart dxMap_;
         FdmHullWhiteOp hullWhiteOp_;
+        mutable Array work_;
     };
 }
 
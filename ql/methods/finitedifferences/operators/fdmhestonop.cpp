@@ -35,6 +35,9 @@ namespace QuantLib {
         const std::shared_ptr<FdmQuantoHelper>& quantoHelper,
         const std::shared_ptr<LocalVolTermStructure>& leverageFct)
     : varianceValues_(0.5*mesher->locations(1)),
+      L_(mesher->layout()->size(), 1.0),
+      drift_(mesher->layout()->size()),
+      shift_(1),
       dxMap_ (FirstDerivativeOp(0, mesher)),
       dxxMap_(SecondDerivativeOp(0, mesher).mult(0.5*mesher->locations(1))),
       mapT_  (0, mesher),
@@ -48,14 +51,9 @@ namespace QuantLib {
         // d^2V/dS^2 is zero and due to Ito's Lemma the variance term
         // in the drift should vanish.
         std::shared_ptr<FdmLinearOpLayout> layout = mesher_->layout();
-        FdmLinearOpIterator endIter = layout->end();
-        for (FdmLinearOpIterator iter = layout->begin(); iter != endIter;
-            ++iter) {
-            if (   iter.coordinates()[0] == 0
-                || iter.coordinates()[0] == layout->dim()[0]-1) {
-                varianceValues_[iter.index()] = 0.0;
-            }
-        }
+        const Size nx = layout->dim()[0];
+        for (Size i=0; i < layout->size(); i+=nx)
+            varianceValues_[i] = varianceValues_[i+nx-1] = 0.0;
         volatilityValues_ = Sqrt(2*varianceValues_);
     }
 
@@ -69,6 +67,14 @@ namespace QuantLib {
                 volatilityValues_, t1, t2),
                 dxMap_, dxxMap_, Array(1, -0.5*r));
         }
+        else if (!leverageFct_) {
+            // L_ is identically one, update the operator in place
+            for (Size i=0; i < drift_.size(); ++i)
+                drift_[i] = r - q - varianceValues_[i];
+            shift_[0] = -0.5*r;
+
+            mapT_.axpyb(drift_, dxMap_, dxxMap_, shift_);
+        }
         else {
             L_ = getLeverageFctSlice(t1, t2);
             const Array Lsquare = L_*L_;
@@ -89,21 +95,19 @@ namespace QuantLib {
         const Real t = 0.5*(t1+t2);
         const Time time = std::min(leverageFct_->maxTime(), t);
 
-        const FdmLinearOpIterator endIter = layout->end();
-        for (FdmLinearOpIterator iter = layout->begin();
-             iter!=endIter; ++iter) {
-            const Size nx = iter.coordinates()[0];
-
-            if (iter.coordinates()[1] == 0) {
-                const Real x = std::exp(mesher_->location(iter, 0));
-                const Real spot = std::min(leverageFct_->maxStrike(),
-                                           std::max(leverageFct_->minStrike(), x));
-                v[nx] = std::max(0.01, leverageFct_->localVol(time, spot, true));
-            }
-            else {
-                v[iter.index()] = v[nx];
-            }
+        // the first line along the spot direction holds the nodes
+        // 0,...,dim()[0]-1; all other lines are copies of it
+        const Size nx = layout->dim()[0];
+        FdmLinearOpIterator iter = layout->begin();
+        for (Size i=0; i < nx; ++i, ++iter) {
+            const Real x = std::exp(mesher_->location(iter, 0));
+            const Real spot = std::min(leverageFct_->maxStrike(),
+                                       std::max(leverageFct_->minStrike(), x));
+            v[i] = std::max(0.01, leverageFct_->localVol(time, spot, true));
         }
+        for (Size i=nx; i < layout->size(); i+=nx)
+            std::copy(v.begin(), v.begin() + nx, v.begin() + i);
+
         return v;
     }
 
@@ -121,12 +125,14 @@ namespace QuantLib {
              .add(FirstDerivativeOp(1, mesher)
                   .mult(kappa*(theta - mesher->locations(1))))),
       mapT_(1, mesher),
+      shift_(1),
       rTS_(rTS) {
     }
 
     void FdmHestonVariancePart::setTime(Time t1, Time t2) {
         const Rate r = rTS_->forwardRate(t1, t2, Continuous).rate();
-        mapT_.axpyb(Array(), dyMap_, dyMap_, Array(1,-0.5*r));
+        shift_[0] = -0.5*r;
+        mapT_.axpyb(Array(), dyMap_, dyMap_, shift_);
     }
 
     const TripleBandLinearOp& FdmHestonVariancePart::getMap() const {
@@ -167,6 +173,47 @@ namespace QuantLib {
               + dxMap_.getL()*correlationMap_.apply(u);
     }
 
+    void FdmHestonOp::apply_into(const Array& u, Array& result) const {
+        // same order of summation as in apply()
+        dyMap_.getMap().apply_into(u, result, pool_.get());
+        dxMap_.getMap().apply_into(u, work_, pool_.get());
+        result += work_;
+        apply_mixed_into(u, work_);
+        result += work_;
+    }
+
+    void FdmHestonOp::apply_mixed_into(const Array& r, Array& result) const {
+        correlationMap_.apply_into(r, result, pool_.get());
+        result *= dxMap_.getL();
+    }
+
+    void FdmHestonOp::apply_direction_into(
+        Size direction, const Array& r, Array& result) const {
+        if (direction == 0)
+            dxMap_.getMap().apply_into(r, result, pool_.get());
+        else if (direction == 1)
+            dyMap_.getMap().apply_into(r, result, pool_.get());
+        else
+            QL_FAIL("direction too large");
+    }
+
+    void FdmHestonOp::solve_splitting_into(
+        Size direction, const Array& r, Real a, Array& result) const {
+        if (direction == 0)
+            dxMap_.getMap().solve_splitting_into(r, a, 1.0, result,
+                                                pool_.get());
+        else if (direction == 1)
+            dyMap_.getMap().solve_splitting_into(r, a, 1.0, result,
+                                                pool_.get());
+        else
+            QL_FAIL("direction too large");
+    }
+
+    void FdmHestonOp::preconditioner_into(
+        const Array& r, Real dt, Array& result) const {
+        solve_splitting_into(0, r, dt, result);
+    }
+
     Array FdmHestonOp::apply_direction(Size direction,
                                                    const Array& r) const {
         if (direction == 0)
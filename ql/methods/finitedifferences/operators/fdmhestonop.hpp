@@ -54,7 +54,7 @@ namespace QuantLib {
       protected:
         Array getLeverageFctSlice(Time t1, Time t2) const;
 
-        Array varianceValues_, volatilityValues_, L_;
+        Array varianceValues_, volatilityValues_, L_, drift_, shift_;
         const FirstDerivativeOp  dxMap_;
         const TripleBandLinearOp dxxMap_;
         TripleBandLinearOp mapT_;
@@ -78,6 +78,7 @@ namespace QuantLib {
       protected:
         const TripleBandLinearOp dyMap_;
         TripleBandLinearOp mapT_;
+        Array shift_;
 
         const std::shared_ptr<YieldTermStructure> rTS_;
     };
@@ -105,12 +106,22 @@ namespace QuantLib {
                                           const Array& r, Real s) const;
         Array preconditioner(const Array& r, Real s) const;
 
+        void apply_into(const Array& r, Array& result) const;
+        void apply_mixed_into(const Array& r, Array& result) const;
+        void apply_direction_into(Size direction, const Array& r,
+                                  Array& result) const;
+        void solve_splitting_into(Size direction, const Array& r, Real s,
+                                  Array& result) const;
+        void preconditioner_into(const Array& r, Real s,
+                                 Array& result) const;
+
         std::vector<SparseMatrix>  toMatrixDecomp() const;
       private:
         NinePointLinearOp correlationMap_;
         FdmHestonVariancePart dyMap_;
         FdmHestonEquityPart dxMap_;
         const std::shared_ptr<LocalVolTermStructure> leverageFct_;
+        mutable Array work_;
     };
 }
 
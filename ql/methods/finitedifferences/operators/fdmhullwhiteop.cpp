@@ -94,6 +94,38 @@ namespace QuantLib {
         return solve_splitting(direction_, r, dt);
     }
 
+    void FdmHullWhiteOp::apply_into(const Array& r, Array& result) const {
+        mapT_.apply_into(r, result, pool_.get());
+    }
+
+    void FdmHullWhiteOp::apply_mixed_into(const Array& r,
+                                          Array& result) const {
+        if (result.size() != r.size())
+            result = Array(r.size());
+        std::fill(result.begin(), result.end(), 0.0);
+    }
+
+    void FdmHullWhiteOp::apply_direction_into(
+        Size direction, const Array& r, Array& result) const {
+        if (direction == direction_)
+            mapT_.apply_into(r, result, pool_.get());
+        else
+            apply_mixed_into(r, result);
+    }
+
+    void FdmHullWhiteOp::solve_splitting_into(
+        Size direction, const Array& r, Real a, Array& result) const {
+        if (direction == direction_)
+            mapT_.solve_splitting_into(r, a, 1.0, result, pool_.get());
+        else
+            apply_mixed_into(r, result);
+    }
+
+    void FdmHullWhiteOp::preconditioner_into(
+        const Array& r, Real dt, Array& result) const {
+        solve_splitting_into(direction_, r, dt, result);
+    }
+
     std::vector<SparseMatrix> 
     FdmHullWhiteOp::toMatrixDecomp() const {
         std::vector<SparseMatrix> retVal(1, mapT_.toMatrix());
@@ -52,6 +52,15 @@ namespace QuantLib {
             solve_splitting(Size direction, const Array& r, Real s) const;
         Array preconditioner(const Array& r, Real s) const;
 
+        void apply_into(const Array& r, Array& result) const;
+        void apply_mixed_into(const Array& r, Array& result) const;
+        void apply_direction_into(Size direction, const Array& r,
+                                  Array& result) const;
+        void solve_splitting_into(Size direction, const Array& r, Real s,
+                                  Array& result) const;
+        void preconditioner_into(const Array& r, Real s,
+                                 Array& result) const;
+
         std::vector<SparseMatrix>  toMatrixDecomp() const;
       private:
         const Size direction_;
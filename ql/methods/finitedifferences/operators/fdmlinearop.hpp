@@ -41,6 +41,14 @@ namespace QuantLib {
         FdmLinearOp& operator=(const FdmLinearOp&) = default;
         FdmLinearOp& operator=(FdmLinearOp&&) = default;
         virtual array_type apply(const array_type& r) const = 0;
+        //! writes apply(r) into \p result, which must not alias \p r
+        /*! Derived operators can override this to avoid allocating
+            a new array; \p result is resized if needed.
+        */
+        virtual void apply_into(const array_type& r,
+                                array_type& result) const {
+            result = apply(r);
+        }
 
         virtual SparseMatrix toMatrix() const = 0;
     };
@@ -29,10 +29,13 @@
 #include <ql/math/matrixutilities/sparsematrix.hpp>
 #include <ql/methods/finitedifferences/operators/fdmlinearop.hpp>
 
+#include <memory>
 #include <numeric>
 
 namespace QuantLib {
 
+    class ThreadPool;
+
     class FdmLinearOpComposite : public FdmLinearOp {
       public:
         virtual Size size() const = 0;
@@ -49,6 +52,48 @@ namespace QuantLib {
         virtual Array 
             preconditioner(const Array& r, Real s) const = 0;
 
+        /*! \name Output-parameter versions
+            These write their result into an existing array, which
+            is resized if needed and must not alias the input (unless
+            stated otherwise by the derived operator).  The default
+            implementations forward to the allocating versions;
+            operators used in time-stepping schemes should override
+            them so that no allocation takes place during a step.
+        */
+        //@{
+        virtual void apply_mixed_into(const Array& r, Array& result) const {
+            result = apply_mixed(r);
+        }
+        virtual void apply_direction_into(Size direction, const Array& r,
+                                          Array& result) const {
+            result = apply_direction(direction, r);
+        }
+        virtual void solve_splitting_into(Size direction, const Array& r,
+                                          Real s, Array& result) const {
+            result = solve_splitting(direction, r, s);
+        }
+        virtual void preconditioner_into(const Array& r, Real s,
+                                         Array& result) const {
+            result = preconditioner(r, s);
+        }
+        //@}
+
+        /*! \name Multi-threading
+            Operators supporting it split the line solves of
+            solve_splitting_into() and the stencil applications of
+            apply_into(), apply_direction_into() and apply_mixed_into()
+            across the given thread pool; the results are the same as
+            in the serial case.  A null pool disables multi-threading.
+        */
+        //@{
+        virtual void setThreadPool(std::shared_ptr<ThreadPool> pool) {
+            pool_ = std::move(pool);
+        }
+        const std::shared_ptr<ThreadPool>& threadPool() const {
+            return pool_;
+        }
+        //@}
+
         virtual std::vector<SparseMatrix>  toMatrixDecomp() const {
             QL_FAIL("FdmLinearOpComposite::toMatrixDecomp not implemented");
         }
@@ -59,6 +104,9 @@ namespace QuantLib {
                                                   SparseMatrix(dcmp.front()));
             return retVal;
         }
+
+      protected:
+        std::shared_ptr<ThreadPool> pool_;
     };
 }
 
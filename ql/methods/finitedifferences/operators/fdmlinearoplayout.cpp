@@ -25,44 +25,17 @@ namespace QuantLib {
 
     Size FdmLinearOpLayout::neighbourhood(const FdmLinearOpIterator& iterator,
                                           Size i, Integer offset) const {
-        Size myIndex = iterator.index()
-            - iterator.coordinates()[i]*spacing_[i];
-
-        Integer coorOffset = Integer(iterator.coordinates()[i])+offset;
-        if (coorOffset < 0) {
-            coorOffset=-coorOffset;
-        }
-        else if (Size(coorOffset) >= dim_[i]) {
-            coorOffset = 2*(dim_[i]-1) - coorOffset;
-        }
-        return myIndex + coorOffset*spacing_[i];
+        return neighbourhood(
+            iterator.index(), iterator.coordinates()[i], i, offset);
     }
 
     Size FdmLinearOpLayout::neighbourhood(const FdmLinearOpIterator& iterator,
                                           Size i1, Integer offset1,
                                           Size i2, Integer offset2) const {
-
-        Size myIndex = iterator.index()
-            - iterator.coordinates()[i1]*spacing_[i1]
-            - iterator.coordinates()[i2]*spacing_[i2];
-
-        Integer coorOffset1 = Integer(iterator.coordinates()[i1])+offset1;
-        if (coorOffset1 < 0) {
-            coorOffset1=-coorOffset1;
-        }
-        else if (Size(coorOffset1) >= dim_[i1]) {
-            coorOffset1 = 2*(dim_[i1]-1) - coorOffset1;
-        }
-
-        Integer coorOffset2 = Integer(iterator.coordinates()[i2])+offset2;
-        if (coorOffset2 < 0) {
-            coorOffset2=-coorOffset2;
-        }
-        else if (Size(coorOffset2) >= dim_[i2]) {
-            coorOffset2 = 2*(dim_[i2]-1) - coorOffset2;
-        }
-
-        return myIndex + coorOffset1*spacing_[i1]+coorOffset2*spacing_[i2];
+        return neighbourhood(
+            neighbourhood(iterator.index(),
+                          iterator.coordinates()[i1], i1, offset1),
+            iterator.coordinates()[i2], i2, offset2);
     }
 
     // smart but sometimes too slow
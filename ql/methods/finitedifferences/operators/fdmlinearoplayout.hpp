@@ -79,6 +79,47 @@ namespace QuantLib {
         FdmLinearOpIterator iter_neighbourhood(
             const FdmLinearOpIterator& iterator, Size i, Integer offset) const;
 
+        /*! \name stride-based access
+
+            The nodes along direction \f$ d \f$ form lines of
+            dim()[d] nodes, each spaced by spacing()[d]. Visiting
+            lineStart(d, l) + c*spacing()[d] for all lines \f$ l \f$
+            and coordinates \f$ c \f$ covers the layout with tight
+            loops and without maintaining a coordinate vector per
+            node as FdmLinearOpIterator does.
+        */
+        //@{
+        //! number of grid lines along the given direction
+        Size lines(Size direction) const {
+            return size_/dim_[direction];
+        }
+        //! index of the first node of the given grid line
+        Size lineStart(Size direction, Size line) const {
+            const Size stride = spacing_[direction];
+            return (line/stride)*stride*dim_[direction] + line%stride;
+        }
+        //! coordinate of the given node along the given direction
+        Size coordinate(Size index, Size direction) const {
+            return (index/spacing_[direction])%dim_[direction];
+        }
+        /*! neighbour of the node with the given index and coordinate
+            along the direction, reflected on the boundaries as in
+            neighbourhood(const FdmLinearOpIterator&, Size, Integer)
+        */
+        Size neighbourhood(Size index, Size coordinate,
+                           Size direction, Integer offset) const {
+            Integer coorOffset = Integer(coordinate)+offset;
+            if (coorOffset < 0) {
+                coorOffset=-coorOffset;
+            }
+            else if (Size(coorOffset) >= dim_[direction]) {
+                coorOffset = 2*(dim_[direction]-1) - coorOffset;
+            }
+            return index - coordinate*spacing_[direction]
+                + coorOffset*spacing_[direction];
+        }
+        //@}
+
       private:
         Size size_;
         std::vector<Size> dim_, spacing_;
@@ -22,11 +22,11 @@
 
 #include <ql/math/functional.hpp>
 #include <ql/processes/ornsteinuhlenbeckprocess.hpp>
-#include <ql/termstructures/yieldtermstructure.hpp>
 #include <ql/methods/finitedifferences/meshers/fdmmesher.hpp>
 #include <ql/methods/finitedifferences/operators/fdmlinearoplayout.hpp>
 #include <ql/methods/finitedifferences/operators/fdmornsteinuhlenbeckop.hpp>
 #include <ql/methods/finitedifferences/operators/secondderivativeop.hpp>
+#include <ql/methods/finitedifferences/utilities/fdmconstantforward.hpp>
 
 namespace QuantLib {
 
@@ -41,6 +41,7 @@ namespace QuantLib {
       rTS_      (rTS),
       bcSet_    (bcSet),
       direction_(direction),
+      timeHomogeneous_(fdmHasConstantForward(rTS)),
       m_        (direction, mesher),
       mapX_     (direction, mesher)  {
 
@@ -66,6 +67,13 @@ namespace QuantLib {
     }
 
     void FdmOrnsteinUhlenbackOp::setTime(Time t1, Time t2) {
+        // the drift is autonomous, therefore the bands are constant
+        // for a constant forward rate; keeping them also keeps the
+        // factorization cached by mapX_
+        if (timeHomogeneous_ && initialized_)
+            return;
+        initialized_ = true;
+
         const Rate r = rTS_->forwardRate(t1, t2, Continuous).rate();
 
         mapX_.axpyb(Array(), m_, m_, Array(1, -r));
@@ -111,6 +119,19 @@ namespace QuantLib {
         return solve_splitting(direction_, r, dt);
     }
 
+    void FdmOrnsteinUhlenbackOp::solve_splitting_into(
+        Size direction, const Array& r, Real a, Array& result) const {
+        if (direction == direction_)
+            mapX_.solve_splitting_into(r, a, 1.0, result, pool_.get());
+        else if (&r != &result)
+            result = r;
+    }
+
+    void FdmOrnsteinUhlenbackOp::preconditioner_into(
+        const Array& r, Real dt, Array& result) const {
+        solve_splitting_into(direction_, r, dt, result);
+    }
+
     std::vector<SparseMatrix> 
     FdmOrnsteinUhlenbackOp::toMatrixDecomp() const {
         std::vector<SparseMatrix> retVal(1, mapX_.toMatrix());
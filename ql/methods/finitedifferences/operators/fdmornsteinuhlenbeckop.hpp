@@ -57,6 +57,11 @@ namespace QuantLib {
                                           const Array& r, Real s) const;
         Array preconditioner(const Array& r, Real s) const;
 
+        void solve_splitting_into(Size direction, const Array& r, Real s,
+                                  Array& result) const;
+        void preconditioner_into(const Array& r, Real s,
+                                 Array& result) const;
+
         std::vector<SparseMatrix>  toMatrixDecomp() const;
       private:
         const std::shared_ptr<FdmMesher> mesher_;
@@ -64,6 +69,9 @@ namespace QuantLib {
         const std::shared_ptr<YieldTermStructure> rTS_;
         const FdmBoundaryConditionSet bcSet_;
         const Size direction_;
+        // constant coefficients, set only once by setTime
+        const bool timeHomogeneous_;
+        bool initialized_ = false;
 
         TripleBandLinearOp m_, mapX_;
     };
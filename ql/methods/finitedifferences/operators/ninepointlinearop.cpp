@@ -22,6 +22,7 @@
 #include <ql/methods/finitedifferences/meshers/fdmmesher.hpp>
 #include <ql/methods/finitedifferences/operators/fdmlinearoplayout.hpp>
 #include <ql/methods/finitedifferences/operators/ninepointlinearop.hpp>
+#include <ql/utilities/threadpool.hpp>
 
 namespace QuantLib {
 
@@ -54,43 +55,67 @@ namespace QuantLib {
             "inconsistent derivative directions");
 
         const std::shared_ptr<FdmLinearOpLayout> layout = mesher->layout();
-        const FdmLinearOpIterator endIter = layout->end();
-
-        for (FdmLinearOpIterator iter = layout->begin(); iter!=endIter; ++iter) {
-            const Size i = iter.index();
-
-            i10_[i] = layout->neighbourhood(iter, d1_, -1);
-            i01_[i] = layout->neighbourhood(iter, d0_, -1);
-            i21_[i] = layout->neighbourhood(iter, d0_,  1);
-            i12_[i] = layout->neighbourhood(iter, d1_,  1);
-            i00_[i] = layout->neighbourhood(iter, d0_, -1, d1_, -1);
-            i20_[i] = layout->neighbourhood(iter, d0_,  1, d1_, -1);
-            i02_[i] = layout->neighbourhood(iter, d0_, -1, d1_,  1);
-            i22_[i] = layout->neighbourhood(iter, d0_,  1, d1_,  1);
+        const Size n0 = layout->dim()[d0_];
+        const Size s0 = layout->spacing()[d0_];
+
+        for (Size l=0; l < layout->lines(d0_); ++l) {
+            const Size start = layout->lineStart(d0_, l);
+            // the coordinate along d1 is constant on a line along d0
+            const Size c1 = layout->coordinate(start, d1_);
+
+            for (Size c0=0, i=start; c0 < n0; ++c0, i+=s0) {
+                i01_[i] = layout->neighbourhood(i, c0, d0_, -1);
+                i21_[i] = layout->neighbourhood(i, c0, d0_,  1);
+                i10_[i] = layout->neighbourhood(i, c1, d1_, -1);
+                i12_[i] = layout->neighbourhood(i, c1, d1_,  1);
+                i00_[i] = layout->neighbourhood(i01_[i], c1, d1_, -1);
+                i20_[i] = layout->neighbourhood(i21_[i], c1, d1_, -1);
+                i02_[i] = layout->neighbourhood(i01_[i], c1, d1_,  1);
+                i22_[i] = layout->neighbourhood(i21_[i], c1, d1_,  1);
+            }
         }
     }
 
     Array NinePointLinearOp::apply(const Array& u)
         const {
+        Array retVal(u.size());
+        apply_into(u, retVal);
+        return retVal;
+    }
+
+    void NinePointLinearOp::apply_into(const Array& u, Array& retVal)
+        const {
+        apply_into(u, retVal, nullptr);
+    }
+
+    void NinePointLinearOp::apply_into(const Array& u, Array& retVal,
+                                       ThreadPool* pool) const {
 
         const std::shared_ptr<FdmLinearOpLayout> index=mesher_->layout();
         QL_REQUIRE(u.size() == index->size(),"inconsistent length of r "
                     << u.size() << " vs " << index->size());
-
-        Array retVal(u.size());
-        // #pragma omp parallel for
-        for (Size i=0; i < retVal.size(); ++i) {
-            retVal[i] =   a00_[i]*u[i00_[i]]
-                        + a01_[i]*u[i01_[i]]
-                        + a02_[i]*u[i02_[i]]
-                        + a10_[i]*u[i10_[i]]
-                        + a11_[i]*u[i]
-                        + a12_[i]*u[i12_[i]]
-                        + a20_[i]*u[i20_[i]]
-                        + a21_[i]*u[i21_[i]]
-                        + a22_[i]*u[i22_[i]];
-        }
-        return retVal;
+        QL_REQUIRE(&u != &retVal, "result must not alias r");
+
+        if (retVal.size() != u.size())
+            retVal = Array(u.size());
+
+        const auto apply = [&](Size begin, Size end) {
+            for (Size i=begin; i < end; ++i) {
+                retVal[i] =   a00_[i]*u[i00_[i]]
+                            + a01_[i]*u[i01_[i]]
+                            + a02_[i]*u[i02_[i]]
+                            + a10_[i]*u[i10_[i]]
+                            + a11_[i]*u[i]
+                            + a12_[i]*u[i12_[i]]
+                            + a20_[i]*u[i20_[i]]
+                            + a21_[i]*u[i21_[i]]
+                            + a22_[i]*u[i22_[i]];
+            }
+        };
+        if (pool != nullptr)
+            pool->parallelForChunks(u.size(), 1, apply);
+        else
+            apply(0, u.size());
     }
 
     SparseMatrix NinePointLinearOp::toMatrix() const {
@@ -32,6 +32,7 @@
 
 namespace QuantLib {
     class FdmMesher;
+    class ThreadPool;
 
     class NinePointLinearOp : public FdmLinearOp {
       public:
@@ -39,6 +40,10 @@ namespace QuantLib {
                 const std::shared_ptr<FdmMesher>& mesher);
 
         Array apply(const Array& r) const;
+        void apply_into(const Array& r, Array& result) const;
+        //! same as above, splitting the nodes across the given pool
+        void apply_into(const Array& r, Array& result,
+                        ThreadPool* pool) const;
         NinePointLinearOp mult(const Array& u) const;
 
         void swap(NinePointLinearOp& m);
@@ -24,6 +24,7 @@
 #include <ql/methods/finitedifferences/tridiagonaloperator.hpp>
 #include <ql/methods/finitedifferences/operators/fdmlinearoplayout.hpp>
 #include <ql/methods/finitedifferences/operators/triplebandlinearop.hpp>
+#include <ql/utilities/threadpool.hpp>
 
 namespace QuantLib {
 
@@ -40,24 +41,25 @@ namespace QuantLib {
               mesher_(mesher) {
 
         const std::shared_ptr<FdmLinearOpLayout> layout = mesher->layout();
-        const FdmLinearOpIterator endIter = layout->end();
-
-        std::vector<Size> newDim(layout->dim());
-        std::iter_swap(newDim.begin(), newDim.begin() + direction_);
-        std::vector<Size> newSpacing = FdmLinearOpLayout(newDim).spacing();
-        std::iter_swap(newSpacing.begin(), newSpacing.begin() + direction_);
-
-        for (FdmLinearOpIterator iter = layout->begin(); iter != endIter; ++iter) {
-            const Size i = iter.index();
-
-            i0_[i] = layout->neighbourhood(iter, direction, -1);
-            i2_[i] = layout->neighbourhood(iter, direction, 1);
-
-            const std::vector<Size> &coordinates = iter.coordinates();
-            const Size newIndex =
-                    std::inner_product(coordinates.begin(), coordinates.end(),
-                                       newSpacing.begin(), Size(0));
-            reverseIndex_[newIndex] = i;
+        const Size n = layout->dim()[direction_];
+        const Size stride = layout->spacing()[direction_];
+        const Size dim0 = layout->dim()[0];
+
+        // reverseIndex_ enumerates the nodes in the order of the layout
+        // having the first direction and direction_ swapped, i.e., the
+        // grid lines along direction_ are stored one after the other.
+        // The line l = b*stride + k of the original layout becomes
+        // b*stride + k/dim0 + (k%dim0)*(stride/dim0) in that order.
+        for (Size l = 0; l < layout->lines(direction_); ++l) {
+            const Size start = layout->lineStart(direction_, l);
+            const Size k = l%stride;
+            const Size newLine = l - k + k/dim0 + (k%dim0)*(stride/dim0);
+
+            for (Size c = 0, i = start; c < n; ++c, i += stride) {
+                i0_[i] = layout->neighbourhood(i, c, direction_, -1);
+                i2_[i] = layout->neighbourhood(i, c, direction_, 1);
+                reverseIndex_[newLine*n + c] = i;
+            }
         }
     }
 
@@ -71,6 +73,11 @@ namespace QuantLib {
         lower_.swap(m.lower_);
         diag_.swap(m.diag_);
         upper_.swap(m.upper_);
+
+        factorUpper_.swap(m.factorUpper_);
+        factorPivot_.swap(m.factorPivot_);
+        std::swap(factorA_, m.factorA_);
+        std::swap(factorB_, m.factorB_);
     }
 
     void TripleBandLinearOp::axpyb(const Array &a,
@@ -78,7 +85,7 @@ namespace QuantLib {
                                    const TripleBandLinearOp &y,
                                    const Array &b) {
         const Size size = mesher_->layout()->size();
-
+        resetFactorization();
 
         if (a.empty()) {
             if (b.empty()) {
@@ -170,6 +177,20 @@ namespace QuantLib {
         }
     }
 
+    void TripleBandLinearOp::axpbyc(Real a, const TripleBandLinearOp &x,
+                                    Real b, const TripleBandLinearOp &y,
+                                    Real c) {
+        const Size size = mesher_->layout()->size();
+        resetFactorization();
+
+        // #pragma omp parallel for
+        for (Size i = 0; i < size; ++i) {
+            diag_[i] = a * x.diag_[i] + b * y.diag_[i] + c;
+            lower_[i] = a * x.lower_[i] + b * y.lower_[i];
+            upper_[i] = a * x.upper_[i] + b * y.upper_[i];
+        }
+    }
+
     TripleBandLinearOp
     TripleBandLinearOp::add(const TripleBandLinearOp &m) const {
 
@@ -237,18 +258,35 @@ namespace QuantLib {
     }
 
     Array TripleBandLinearOp::apply(const Array &r) const {
+        array_type retVal(r.size());
+        apply_into(r, retVal);
+
+        return retVal;
+    }
+
+    void TripleBandLinearOp::apply_into(const Array &r, Array &result) const {
+        apply_into(r, result, nullptr);
+    }
+
+    void TripleBandLinearOp::apply_into(const Array &r, Array &result,
+                                        ThreadPool* pool) const {
         const std::shared_ptr<FdmLinearOpLayout> index = mesher_->layout();
 
         QL_REQUIRE(r.size() == index->size(), "inconsistent length of r");
+        QL_REQUIRE(&r != &result, "result must not alias r");
 
+        if (result.size() != r.size())
+            result = Array(r.size());
 
-        array_type retVal(r.size());
-        // #pragma omp parallel for
-        for (Size i = 0; i < index->size(); ++i) {
-            retVal[i] = r[i0_[i]] * lower_[i] + r[i] * diag_[i] + r[i2_[i]] * upper_[i];
-        }
-
-        return retVal;
+        const auto apply = [&](Size begin, Size end) {
+            for (Size i = begin; i < end; ++i) {
+                result[i] = r[i0_[i]] * lower_[i] + r[i] * diag_[i] + r[i2_[i]] * upper_[i];
+            }
+        };
+        if (pool != nullptr)
+            pool->parallelForChunks(r.size(), 1, apply);
+        else
+            apply(0, r.size());
     }
 
     SparseMatrix TripleBandLinearOp::toMatrix() const {
@@ -268,10 +306,60 @@ namespace QuantLib {
 
     Array
     TripleBandLinearOp::solve_splitting(const Array &r, Real a, Real b) const {
+        Array retVal(r.size()), tmp(r.size());
+        solve_splitting(r, a, b, retVal, tmp);
+
+        return retVal;
+    }
+
+    void TripleBandLinearOp::solve_splitting_into(const Array &r,
+                                                  Real a, Real b,
+                                                  Array &result,
+                                                  ThreadPool* pool) const {
         const std::shared_ptr<FdmLinearOpLayout> layout = mesher_->layout();
         QL_REQUIRE(r.size() == layout->size(), "inconsistent size of rhs");
+        if (result.size() != r.size())
+            result = Array(r.size());
+
+        const bool factorized = (a == factorA_ && b == factorB_);
+        if (!factorized) {
+            checkBoundaries();
+            resetFactorization();
+            if (factorUpper_.size() != r.size()) {
+                factorUpper_ = Array(r.size());
+                factorPivot_ = Array(r.size());
+            }
+        }
+
+        const auto solve = [&](Size first, Size last) {
+            if (!factorized)
+                factorize_lines(a, b, first, last);
+            substitute_lines(r, a, result, first, last);
+        };
+        // the grid lines are contiguous in reverseIndex_
+        if (pool != nullptr)
+            pool->parallelForChunks(r.size(), layout->dim()[direction_],
+                                    solve);
+        else
+            solve(0, r.size());
+
+        factorA_ = a;
+        factorB_ = b;
+    }
+
+    void TripleBandLinearOp::solve_splitting(const Array &r, Real a, Real b,
+                                             Array &retVal,
+                                             Array &tmp) const {
+        const std::shared_ptr<FdmLinearOpLayout> layout = mesher_->layout();
+        QL_REQUIRE(r.size() == layout->size(), "inconsistent size of rhs");
+
+        checkBoundaries();
+        solve_lines(r, a, b, retVal, tmp, 0, layout->size());
+    }
 
+    void TripleBandLinearOp::checkBoundaries() const {
 #ifdef QL_EXTRA_SAFETY_CHECKS
+        const std::shared_ptr<FdmLinearOpLayout> layout = mesher_->layout();
         for (FdmLinearOpIterator iter = layout->begin();
              iter!=layout->end(); ++iter) {
             const std::vector<Size>& coordinates = iter.coordinates();
@@ -281,19 +369,26 @@ namespace QuantLib {
                        || upper_[iter.index()] == 0,"removing non zero entry!");
         }
 #endif
+    }
 
-        Array retVal(r.size()), tmp(r.size());
-
-
+    void TripleBandLinearOp::solve_lines(const Array &r, Real a, Real b,
+                                         Array &retVal, Array &tmp,
+                                         Size first, Size last) const {
         // Thomson algorithm to solve a tridiagonal system.
         // Example code taken from Tridiagonalopertor and
         // changed to fit for the triple band operator.
-        Size rim1 = reverseIndex_[0];
+        // Each r[ri] is read before retVal[ri] is written and never
+        // afterwards, therefore retVal can alias r.
+        // The grid lines are decoupled, as the lower and upper
+        // diagonals vanish on the boundaries; therefore, solving a
+        // range of whole lines on its own gives the same result as
+        // solving the whole system at once.
+        Size rim1 = reverseIndex_[first];
         Real bet = 1.0 / (a * diag_[rim1] + b);
         QL_REQUIRE(bet != 0.0, "division by zero");
-        retVal[reverseIndex_[0]] = r[rim1] * bet;
+        retVal[reverseIndex_[first]] = r[rim1] * bet;
 
-        for (Size j = 1; j <= layout->size() - 1; j++) {
+        for (Size j = first + 1; j <= last - 1; j++) {
             const Size ri = reverseIndex_[j];
             tmp[j] = a * upper_[rim1] * bet;
 
@@ -304,11 +399,50 @@ namespace QuantLib {
             retVal[ri] = (r[ri] - a * lower_[ri] * retVal[rim1]) * bet;
             rim1 = ri;
         }
-        // cannot be j>=0 with Size j
-        for (Size j = layout->size() - 2; j > 0; --j)
+        // cannot be j>=first with Size j
+        for (Size j = last - 2; j > first; --j)
             retVal[reverseIndex_[j]] -= tmp[j + 1] * retVal[reverseIndex_[j + 1]];
-        retVal[reverseIndex_[0]] -= tmp[1] * retVal[reverseIndex_[1]];
+        retVal[reverseIndex_[first]] -= tmp[first + 1] * retVal[reverseIndex_[first + 1]];
+    }
 
-        return retVal;
+    void TripleBandLinearOp::factorize_lines(Real a, Real b,
+                                             Size first, Size last) const {
+        // forward elimination of solve_lines without right-hand side
+        Size rim1 = reverseIndex_[first];
+        Real bet = 1.0 / (a * diag_[rim1] + b);
+        QL_REQUIRE(bet != 0.0, "division by zero");
+        factorPivot_[first] = bet;
+
+        for (Size j = first + 1; j <= last - 1; j++) {
+            const Size ri = reverseIndex_[j];
+            factorUpper_[j] = a * upper_[rim1] * bet;
+
+            bet = b + a * (diag_[ri] - factorUpper_[j] * lower_[ri]);
+            QL_ENSURE(bet != 0.0, "division by zero");
+            bet = 1.0 / bet;
+
+            factorPivot_[j] = bet;
+            rim1 = ri;
+        }
+    }
+
+    void TripleBandLinearOp::substitute_lines(const Array &r, Real a,
+                                              Array &retVal,
+                                              Size first, Size last) const {
+        // same operations as in solve_lines, hence the same result
+        Size rim1 = reverseIndex_[first];
+        retVal[rim1] = r[rim1] * factorPivot_[first];
+
+        for (Size j = first + 1; j <= last - 1; j++) {
+            const Size ri = reverseIndex_[j];
+            retVal[ri] = (r[ri] - a * lower_[ri] * retVal[rim1])
+                * factorPivot_[j];
+            rim1 = ri;
+        }
+        for (Size j = last - 2; j > first; --j)
+            retVal[reverseIndex_[j]] -=
+                factorUpper_[j + 1] * retVal[reverseIndex_[j + 1]];
+        retVal[reverseIndex_[first]] -=
+            factorUpper_[first + 1] * retVal[reverseIndex_[first + 1]];
     }
 }
@@ -28,19 +28,38 @@
 #define quantlib_triple_band_linear_op_hpp
 
 #include <ql/methods/finitedifferences/operators/fdmlinearop.hpp>
+#include <ql/utilities/null.hpp>
 
 namespace QuantLib {
 
     class FdmMesher;
-    
+    class ThreadPool;
+
     class TripleBandLinearOp : public FdmLinearOp {
       public:
         TripleBandLinearOp(Size direction,
                            const std::shared_ptr<FdmMesher>& mesher);
 
         Array apply(const Array& r) const;
+        void apply_into(const Array& r, Array& result) const;
+        //! same as above, splitting the nodes across the given pool
+        void apply_into(const Array& r, Array& result,
+                        ThreadPool* pool) const;
         Array solve_splitting(const Array& r, Real a,
                                           Real b = 1.0) const;
+        /*! Same as solve_splitting, but writes the solution into
+            \p result, which may alias \p r.  An internal work array
+            is used, so that concurrent calls on the same operator are
+            not allowed.
+
+            If a thread pool is given, the tridiagonal systems along
+            the grid lines in the direction of the operator, which are
+            independent, are solved concurrently; the result is the
+            same as in the serial case.
+        */
+        void solve_splitting_into(const Array& r, Real a, Real b,
+                                  Array& result,
+                                  ThreadPool* pool = nullptr) const;
 
         TripleBandLinearOp mult(const Array& u) const;
         // interpret u as the diagonal of a diagonal matrix, multiplied on LHS
@@ -52,6 +71,9 @@ namespace QuantLib {
         // some very basic linear algebra routines
         void axpyb(const Array& a, const TripleBandLinearOp& x,
                    const TripleBandLinearOp& y, const Array& b);
+        // same as above with scalar coefficients: a*x + b*y + c
+        void axpbyc(Real a, const TripleBandLinearOp& x,
+                    Real b, const TripleBandLinearOp& y, Real c);
 
         void swap(TripleBandLinearOp& m);
 
@@ -60,12 +82,35 @@ namespace QuantLib {
       protected:
         TripleBandLinearOp() = default;
 
+        void solve_splitting(const Array& r, Real a, Real b,
+                             Array& result, Array& tmp) const;
+        // solves the systems along the grid lines stored at positions
+        // [first, last) of reverseIndex_
+        void solve_lines(const Array& r, Real a, Real b,
+                         Array& result, Array& tmp,
+                         Size first, Size last) const;
+
         Size direction_;
         std::vector<Size> i0_, i2_;
         std::vector<Size> reverseIndex_;
         std::vector<Real> lower_, diag_, upper_;
 
         std::shared_ptr<FdmMesher> mesher_;
+
+        //! to be called by derived classes modifying the bands
+        void resetFactorization() const { factorA_ = Null<Real>(); }
+
+      private:
+        void checkBoundaries() const;
+        // stores the forward-elimination coefficients of the lines
+        // at positions [first, last) of reverseIndex_
+        void factorize_lines(Real a, Real b, Size first, Size last) const;
+        void substitute_lines(const Array& r, Real a, Array& result,
+                              Size first, Size last) const;
+
+        // cached factorization of b + a*L, see solve_splitting_into
+        mutable Array factorUpper_, factorPivot_;
+        mutable Real factorA_ = Null<Real>(), factorB_ = Null<Real>();
     };
 }
 
@@ -29,12 +29,27 @@ namespace QuantLib {
     }
 
     void ExplicitEulerScheme::step(array_type& a, Time t) {
+        prepare(t);
+        evolve(a);
+    }
+
+    void ExplicitEulerScheme::step(std::vector<array_type>& a, Time t) {
+        prepare(t);
+        for (auto& x : a)
+            evolve(x);
+    }
+
+    void ExplicitEulerScheme::prepare(Time t) {
         QL_REQUIRE(t-dt_ > -1e-8, "a step towards negative time given");
         map_->setTime(std::max(0.0, t - dt_), t);
         bcSet_.setTime(std::max(0.0, t-dt_));
+    }
 
+    void ExplicitEulerScheme::evolve(array_type& a) {
         bcSet_.applyBeforeApplying(*map_);
-        a += dt_ * map_->apply(a);
+        map_->apply_into(a, work_);
+        work_ *= dt_;
+        a += work_;
         bcSet_.applyAfterApplying(a);
     }
 
@@ -50,6 +50,8 @@ namespace QuantLib {
             const bc_set& bcSet = bc_set());
 
         void step(array_type& a, Time t);
+        //! steps all arrays, setting the operator time only once
+        void step(std::vector<array_type>& a, Time t);
         void setStep(Time dt);
 
       protected:
@@ -59,6 +61,13 @@ namespace QuantLib {
 
         const std::shared_ptr<FdmLinearOpComposite> map_;
         const BoundaryConditionSchemeHelper bcSet_;
+
+      private:
+        void prepare(Time t);
+        void evolve(array_type& a);
+
+        // work arrays reused across steps
+        Array y_, y0_, yt_, diff_, rhs_;
     };
 }
 
@@ -19,35 +19,83 @@
  FOR A PARTICULAR PURPOSE.  See the license for more details.
 */
 
-#include <ql/math/matrixutilities/bicgstab.hpp>
 #include <ql/methods/finitedifferences/schemes/impliciteulerscheme.hpp>
+#include <ql/methods/finitedifferences/utilities/fdmsparselinearsolver.hpp>
 
 namespace QuantLib {
 
     ImplicitEulerScheme::ImplicitEulerScheme(
             const std::shared_ptr<FdmLinearOpComposite> &map,
             const bc_set &bcSet,
-            Real relTol)
+            Real relTol,
+            SolverType solverType)
             : dt_(Null<Real>()),
               relTol_(relTol),
               map_(map),
-              bcSet_(bcSet) {
+              bcSet_(bcSet),
+              sparseSolver_(solverType == SparseBiCGstab
+                            ? std::make_shared<FdmSparseLinearSolver>(
+                                  map, relTol)
+                            : std::shared_ptr<FdmSparseLinearSolver>()) {
+    }
+
+    ImplicitEulerScheme::ImplicitEulerScheme(const ImplicitEulerScheme& other)
+    : dt_(other.dt_),
+      relTol_(other.relTol_),
+      map_(other.map_),
+      bcSet_(other.bcSet_),
+      sparseSolver_(other.sparseSolver_) {
     }
 
     Array ImplicitEulerScheme::apply(const Array &r) const {
         return r - dt_ * map_->apply(r);
     }
 
-    void ImplicitEulerScheme::step(array_type &a, Time t) {
+    void ImplicitEulerScheme::apply_into(const Array& r, Array& result) const {
+        map_->apply_into(r, result);
+        result *= -dt_;
+        result += r;
+    }
+
+    void ImplicitEulerScheme::step(array_type& a, Time t) {
+        prepare(t);
+        evolve(a);
+    }
+
+    void ImplicitEulerScheme::step(std::vector<array_type>& a, Time t) {
+        prepare(t);
+        for (auto& x : a)
+            evolve(x);
+    }
+
+    void ImplicitEulerScheme::prepare(Time t) {
         QL_REQUIRE(t - dt_ > -1e-8, "a step towards negative time given");
         map_->setTime(std::max(0.0, t - dt_), t);
         bcSet_.setTime(std::max(0.0, t - dt_));
+        if (sparseSolver_ != nullptr)
+            sparseSolver_->setStep(dt_);
+    }
 
+    void ImplicitEulerScheme::evolve(array_type& a) {
         bcSet_.applyBeforeSolving(*map_, a);
 
-        a = BiCGstab([this](const Array &r){ return this->apply(r); },
-                        10 * a.size(), relTol_,
-                        [this](const Array &r){ return this->map_->preconditioner(r, -dt_); }).solve(a).x;
+        if (sparseSolver_ != nullptr) {
+            sparseSolver_->solve(a);
+        }
+        else {
+            if (!bicgstab_ || rhs_.size() != a.size()) {
+                rhs_ = Array(a.size());
+                bicgstab_ = std::make_unique<InPlaceBiCGstab>(
+                    [this](const Array& r, Array& y) { apply_into(r, y); },
+                    10 * a.size(), relTol_,
+                    [this](const Array& r, Array& y) {
+                        map_->preconditioner_into(r, -dt_, y);
+                    });
+            }
+            // the right-hand side is the initial guess
+            std::copy(a.begin(), a.end(), rhs_.begin());
+            bicgstab_->solve(rhs_, a);
+        }
 
         bcSet_.applyAfterSolving(a);
     }
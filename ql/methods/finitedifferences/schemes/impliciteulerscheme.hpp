@@ -26,14 +26,26 @@
 #ifndef quantlib_implicit_euler_scheme_hpp
 #define quantlib_implicit_euler_scheme_hpp
 
+#include <ql/math/matrixutilities/bicgstab.hpp>
 #include <ql/methods/finitedifferences/operatortraits.hpp>
 #include <ql/methods/finitedifferences/operators/fdmlinearopcomposite.hpp>
 #include <ql/methods/finitedifferences/schemes/boundaryconditionschemehelper.hpp>
 
 namespace QuantLib {
 
+    class FdmSparseLinearSolver;
+
     class ImplicitEulerScheme {
       public:
+        /*! BiCGstab works on the operator through its apply and
+            preconditioner methods; SparseBiCGstab assembles the
+            operator as a sparse matrix and reuses an incomplete LU
+            preconditioner across time steps (see
+            FdmSparseLinearSolver), which pays off for operators with
+            mixed derivatives on large grids.
+        */
+        enum SolverType { BiCGstab, SparseBiCGstab };
+
         // typedefs
         typedef OperatorTraits<FdmLinearOp> traits;
         typedef traits::operator_type operator_type;
@@ -45,9 +57,16 @@ namespace QuantLib {
         ImplicitEulerScheme(
             const std::shared_ptr<FdmLinearOpComposite>& map,
             const bc_set& bcSet = bc_set(),
-            Real relTol = 1e-8);
+            Real relTol = 1e-8,
+            SolverType solverType = BiCGstab);
+        /*! copies don't share the BiCGstab work arrays, which refer
+            to the scheme they belong to
+        */
+        ImplicitEulerScheme(const ImplicitEulerScheme& other);
 
         void step(array_type& a, Time t);
+        //! steps all arrays, setting the operator time only once
+        void step(std::vector<array_type>& a, Time t);
         void setStep(Time dt);
 
       protected:
@@ -57,6 +76,17 @@ namespace QuantLib {
         const Real relTol_;
         const std::shared_ptr<FdmLinearOpComposite> map_;
         const BoundaryConditionSchemeHelper bcSet_;
+        // shared by the copies of the scheme
+        const std::shared_ptr<FdmSparseLinearSolver> sparseSolver_;
+
+      private:
+        void prepare(Time t);
+        void evolve(array_type& a);
+        void apply_into(const Array& r, Array& result) const;
+
+        // reused across steps
+        std::unique_ptr<InPlaceBiCGstab> bicgstab_;
+        Array rhs_;
     };
 }
 
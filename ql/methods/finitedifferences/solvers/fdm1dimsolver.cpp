@@ -46,6 +46,9 @@ namespace QuantLib {
       initialValues_(solverDesc.mesher->layout()->size()),
       resultValues_ (solverDesc.mesher->layout()->size()) {
 
+        if (solverDesc.threadPool)
+            op_->setThreadPool(solverDesc.threadPool);
+
         const std::shared_ptr<FdmMesher> mesher = solverDesc.mesher;
         const std::shared_ptr<FdmLinearOpLayout> layout = mesher->layout();
 
@@ -46,6 +46,9 @@ namespace QuantLib {
       resultValues_ (solverDesc.mesher->layout()->dim()[1],
                      solverDesc.mesher->layout()->dim()[0]) {
 
+        if (solverDesc.threadPool)
+            op_->setThreadPool(solverDesc.threadPool);
+
         const std::shared_ptr<FdmMesher> mesher = solverDesc.mesher;
         const std::shared_ptr<FdmLinearOpLayout> layout = mesher->layout();
 
@@ -50,6 +50,9 @@ namespace QuantLib {
                             solverDesc.mesher->layout()->dim()[0])),
       interpolation_(solverDesc.mesher->layout()->dim()[2]) {
 
+        if (solverDesc.threadPool)
+            op_->setThreadPool(solverDesc.threadPool);
+
         const std::shared_ptr<FdmMesher> mesher = solverDesc.mesher;
         const std::shared_ptr<FdmLinearOpLayout> layout = mesher->layout();
 
@@ -23,6 +23,7 @@
 */
 
 #include <ql/methods/finitedifferences/finitedifferencemodel.hpp>
+#include <ql/methods/finitedifferences/parallelevolver.hpp>
 #include <ql/methods/finitedifferences/solvers/fdmbackwardsolver.hpp>
 #include <ql/methods/finitedifferences/schemes/douglasscheme.hpp>
 #include <ql/methods/finitedifferences/schemes/craigsneydscheme.hpp>
@@ -68,6 +69,132 @@ namespace QuantLib {
         return FdmSchemeDesc(FdmSchemeDesc::ImplicitEulerType, 0.0, 0.0);
     }
 
+    FdmSchemeDesc FdmSchemeDesc::ImplicitEulerSparse() {
+        return FdmSchemeDesc(FdmSchemeDesc::ImplicitEulerSparseType,
+                             0.0, 0.0);
+    }
+
+    namespace {
+
+        // steps several arrays at once, see FdmBackwardSolver::rollback
+        template <class Scheme>
+        class MultiArrayScheme {
+          public:
+            typedef ParallelEvolverTraits<typename Scheme::traits> traits;
+            typedef typename traits::array_type array_type;
+
+            explicit MultiArrayScheme(const Scheme& scheme)
+            : scheme_(scheme) {}
+
+            void step(array_type& a, Time t) { scheme_.step(a, t); }
+            void setStep(Time dt) { scheme_.setStep(dt); }
+
+          private:
+            Scheme scheme_;
+        };
+
+        template <class Scheme, class Condition>
+        void rollbackWith(const Scheme& scheme, Array& a,
+                          Time from, Time to, Size steps,
+                          const Condition& condition,
+                          const std::vector<Time>& stoppingTimes) {
+            FiniteDifferenceModel<Scheme> model(scheme, stoppingTimes);
+            model.rollback(a, from, to, steps, condition);
+        }
+
+        template <class Scheme, class Condition>
+        void rollbackWith(const Scheme& scheme, std::vector<Array>& a,
+                          Time from, Time to, Size steps,
+                          const Condition& condition,
+                          const std::vector<Time>& stoppingTimes) {
+            FiniteDifferenceModel<MultiArrayScheme<Scheme> > model(
+                MultiArrayScheme<Scheme>(scheme), stoppingTimes);
+            model.rollback(a, from, to, steps, condition);
+        }
+
+        template <class ArrayType, class Condition>
+        void rollbackImpl(
+                const std::shared_ptr<FdmLinearOpComposite>& map,
+                const FdmBoundaryConditionSet& bcSet,
+                const FdmSchemeDesc& schemeDesc,
+                ArrayType& a, const Condition& condition,
+                const std::vector<Time>& stoppingTimes,
+                Time from, Time to, Size steps, Size dampingSteps) {
+
+            const Time deltaT = from - to;
+            const Size allSteps = steps + dampingSteps;
+            const Time dampingTo = from - (deltaT*dampingSteps)/allSteps;
+
+            if (   dampingSteps
+                && schemeDesc.type != FdmSchemeDesc::ImplicitEulerType
+                && schemeDesc.type != FdmSchemeDesc::ImplicitEulerSparseType) {
+                ImplicitEulerScheme implicitEvolver(map, bcSet);
+                rollbackWith(implicitEvolver, a, from, dampingTo, dampingSteps,
+                             condition, stoppingTimes);
+            }
+
+            switch (schemeDesc.type) {
+              case FdmSchemeDesc::HundsdorferType:
+                {
+                    HundsdorferScheme hsEvolver(schemeDesc.theta, schemeDesc.mu,
+                                                map, bcSet);
+                    rollbackWith(hsEvolver, a, dampingTo, to, steps,
+                                 condition, stoppingTimes);
+                }
+                break;
+              case FdmSchemeDesc::DouglasType:
+                {
+                    DouglasScheme dsEvolver(schemeDesc.theta, map, bcSet);
+                    rollbackWith(dsEvolver, a, dampingTo, to, steps,
+                                 condition, stoppingTimes);
+                }
+                break;
+              case FdmSchemeDesc::CraigSneydType:
+                {
+                    CraigSneydScheme csEvolver(schemeDesc.theta, schemeDesc.mu,
+                                               map, bcSet);
+                    rollbackWith(csEvolver, a, dampingTo, to, steps,
+                                 condition, stoppingTimes);
+                }
+                break;
+              case FdmSchemeDesc::ModifiedCraigSneydType:
+                {
+                    ModifiedCraigSneydScheme csEvolver(schemeDesc.theta,
+                                                       schemeDesc.mu,
+                                                       map, bcSet);
+                    rollbackWith(csEvolver, a, dampingTo, to, steps,
+                                 condition, stoppingTimes);
+                }
+                break;
+              case FdmSchemeDesc::ImplicitEulerType:
+                {
+                    ImplicitEulerScheme implicitEvolver(map, bcSet);
+                    rollbackWith(implicitEvolver, a, from, to, allSteps,
+                                 condition, stoppingTimes);
+                }
+                break;
+              case FdmSchemeDesc::ImplicitEulerSparseType:
+                {
+                    ImplicitEulerScheme implicitEvolver(
+                        map, bcSet, 1e-8, ImplicitEulerScheme::SparseBiCGstab);
+                    rollbackWith(implicitEvolver, a, from, to, allSteps,
+                                 condition, stoppingTimes);
+                }
+                break;
+              case FdmSchemeDesc::ExplicitEulerType:
+                {
+                    ExplicitEulerScheme explicitEvolver(map, bcSet);
+                    rollbackWith(explicitEvolver, a, dampingTo, to, steps,
+                                 condition, stoppingTimes);
+                }
+                break;
+              default:
+                QL_FAIL("Unknown scheme type");
+            }
+        }
+
+    }
+
     FdmBackwardSolver::FdmBackwardSolver(
         const std::shared_ptr<FdmLinearOpComposite>& map,
         const FdmBoundaryConditionSet& bcSet,
@@ -84,75 +211,36 @@ namespace QuantLib {
     void FdmBackwardSolver::rollback(FdmBackwardSolver::array_type& rhs, 
                                      Time from, Time to,
                                      Size steps, Size dampingSteps) {
+        rollbackImpl(map_, bcSet_, schemeDesc_,
+                     rhs, *condition_, condition_->stoppingTimes(),
+                     from, to, steps, dampingSteps);
+    }
 
-        const Time deltaT = from - to;
-        const Size allSteps = steps + dampingSteps;
-        const Time dampingTo = from - (deltaT*dampingSteps)/allSteps;
-                    
-        if (   dampingSteps 
-            && schemeDesc_.type != FdmSchemeDesc::ImplicitEulerType) {
-            ImplicitEulerScheme implicitEvolver(map_, bcSet_);    
-            FiniteDifferenceModel<ImplicitEulerScheme> 
-                    dampingModel(implicitEvolver, condition_->stoppingTimes());
-            dampingModel.rollback(rhs, from, dampingTo, 
-                                  dampingSteps, *condition_);
-        }
-        
-        switch (schemeDesc_.type) {
-          case FdmSchemeDesc::HundsdorferType:
-            {
-                HundsdorferScheme hsEvolver(schemeDesc_.theta, schemeDesc_.mu, 
-                                            map_, bcSet_);
-                FiniteDifferenceModel<HundsdorferScheme> 
-                               hsModel(hsEvolver, condition_->stoppingTimes());
-                hsModel.rollback(rhs, dampingTo, to, steps, *condition_);
-            }
-            break;
-          case FdmSchemeDesc::DouglasType:
-            {
-                DouglasScheme dsEvolver(schemeDesc_.theta, map_, bcSet_);
-                FiniteDifferenceModel<DouglasScheme> 
-                               dsModel(dsEvolver, condition_->stoppingTimes());
-                dsModel.rollback(rhs, dampingTo, to, steps, *condition_);
-            }
-            break;
-          case FdmSchemeDesc::CraigSneydType:
-            {
-                CraigSneydScheme csEvolver(schemeDesc_.theta, schemeDesc_.mu, 
-                                           map_, bcSet_);
-                FiniteDifferenceModel<CraigSneydScheme> 
-                               csModel(csEvolver, condition_->stoppingTimes());
-                csModel.rollback(rhs, dampingTo, to, steps, *condition_);
-            }
-            break;
-          case FdmSchemeDesc::ModifiedCraigSneydType:
-            {
-                ModifiedCraigSneydScheme csEvolver(schemeDesc_.theta, 
-                                                   schemeDesc_.mu,
-                                                   map_, bcSet_);
-                FiniteDifferenceModel<ModifiedCraigSneydScheme> 
-                              mcsModel(csEvolver, condition_->stoppingTimes());
-                mcsModel.rollback(rhs, dampingTo, to, steps, *condition_);
-            }
-            break;
-          case FdmSchemeDesc::ImplicitEulerType:
-            {
-                ImplicitEulerScheme implicitEvolver(map_, bcSet_);
-                FiniteDifferenceModel<ImplicitEulerScheme> 
-                   implicitModel(implicitEvolver, condition_->stoppingTimes());
-                implicitModel.rollback(rhs, from, to, allSteps, *condition_);
-            }
-            break;
-          case FdmSchemeDesc::ExplicitEulerType:
-            {
-                ExplicitEulerScheme explicitEvolver(map_, bcSet_);
-                FiniteDifferenceModel<ExplicitEulerScheme> 
-                   explicitModel(explicitEvolver, condition_->stoppingTimes());
-                explicitModel.rollback(rhs, dampingTo, to, steps, *condition_);
-            }
-            break;
-          default:
-            QL_FAIL("Unknown scheme type");
+    void FdmBackwardSolver::rollback(
+        std::vector<array_type>& rhs,
+        const std::vector<std::shared_ptr<FdmStepConditionComposite> >&
+                                                                conditions,
+        Time from, Time to, Size steps, Size dampingSteps) {
+
+        QL_REQUIRE(conditions.empty() || conditions.size() == rhs.size(),
+                   "number of step conditions (" << conditions.size()
+                   << ") differs from number of arrays ("
+                   << rhs.size() << ")");
+
+        StepConditionSet<array_type> conditionSet;
+        std::vector<Time> stoppingTimes;
+        for (Size i=0; i < rhs.size(); ++i) {
+            const std::shared_ptr<FdmStepConditionComposite> condition =
+                (conditions.empty() || !conditions[i]) ? condition_
+                                                       : conditions[i];
+            conditionSet.emplace_back(condition);
+            stoppingTimes.insert(stoppingTimes.end(),
+                                 condition->stoppingTimes().begin(),
+                                 condition->stoppingTimes().end());
         }
+
+        rollbackImpl(map_, bcSet_, schemeDesc_,
+                     rhs, conditionSet, stoppingTimes,
+                     from, to, steps, dampingSteps);
     }
 }
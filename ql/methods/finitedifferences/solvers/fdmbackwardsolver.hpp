@@ -35,7 +35,8 @@ namespace QuantLib {
     struct FdmSchemeDesc {
         enum FdmSchemeType { HundsdorferType, DouglasType, 
                              CraigSneydType, ModifiedCraigSneydType, 
-                             ImplicitEulerType, ExplicitEulerType };
+                             ImplicitEulerType, ExplicitEulerType,
+                             ImplicitEulerSparseType };
 
         FdmSchemeDesc(FdmSchemeType type, Real theta, Real mu);
 
@@ -45,6 +46,8 @@ namespace QuantLib {
         // some default scheme descriptions
         static FdmSchemeDesc Douglas();
         static FdmSchemeDesc ImplicitEuler();
+        //! implicit Euler with the sparse solver, see FdmSparseLinearSolver
+        static FdmSchemeDesc ImplicitEulerSparse();
         static FdmSchemeDesc ExplicitEuler();
         static FdmSchemeDesc CraigSneyd();
         static FdmSchemeDesc ModifiedCraigSneyd(); 
@@ -66,6 +69,24 @@ namespace QuantLib {
                       Time from, Time to,
                       Size steps, Size dampingSteps);
 
+        /*! Rolls back several arrays on the same mesh in a single
+            backward sweep, e.g., the payoffs of options with
+            different strikes on a multi-strike mesher.  The operator
+            is set to each time step only once for all arrays.
+
+            The i-th array is subject to the i-th step condition,
+            or to the one passed to the constructor if the condition
+            is null or none are given.  All arrays share the union of
+            the stopping times of the conditions; the results are
+            the same as when rolling back each array on its own if
+            the stopping times coincide.
+        */
+        void rollback(
+            std::vector<array_type>& a,
+            const std::vector<std::shared_ptr<FdmStepConditionComposite> >&
+                                                                conditions,
+            Time from, Time to, Size steps, Size dampingSteps);
+
       protected:
         const std::shared_ptr<FdmLinearOpComposite> map_;
         const FdmBoundaryConditionSet bcSet_;
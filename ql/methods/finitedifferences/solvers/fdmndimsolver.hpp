@@ -91,6 +91,9 @@ namespace QuantLib {
       initialValues_(solverDesc.mesher->layout()->size()),
       extrapolation_(std::vector<bool>(N, false)) {
 
+        if (solverDesc.threadPool)
+            op_->setThreadPool(solverDesc.threadPool);
+
         const std::shared_ptr<FdmMesher> mesher = solverDesc.mesher;
         const std::shared_ptr<FdmLinearOpLayout> layout = mesher->layout();
 
@@ -31,6 +31,7 @@ namespace QuantLib {
     class FdmInnerValueCalculator;
     class FdmStepConditionComposite;
     class FdmInnerValueCalculator;
+    class ThreadPool;
 
     struct FdmSolverDesc {
         const std::shared_ptr<FdmMesher> mesher;
@@ -40,6 +41,9 @@ namespace QuantLib {
         const Time maturity;
         const Size timeSteps;
         const Size dampingSteps;
+        //! if given, passed to the operator of the solver
+        /*! see FdmLinearOpComposite::setThreadPool */
+        const std::shared_ptr<ThreadPool> threadPool = nullptr;
     };
 }
 
@@ -0,0 +1,35 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file fdmconstantforward.cpp
+    \brief detection of constant instantaneous forward rates
+*/
+
+#include <ql/methods/finitedifferences/utilities/fdmconstantforward.hpp>
+#include <ql/termstructures/yield/flatforward.hpp>
+
+namespace QuantLib {
+
+    bool fdmHasConstantForward(const std::shared_ptr<YieldTermStructure>& ts) {
+        const std::shared_ptr<FlatForward> flat =
+            std::dynamic_pointer_cast<FlatForward>(ts);
+        return flat != nullptr
+            && (flat->compounding() == Continuous
+                || flat->compounding() == Compounded);
+    }
+
+}
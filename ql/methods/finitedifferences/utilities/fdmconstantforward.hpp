@@ -0,0 +1,40 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file fdmconstantforward.hpp
+    \brief detection of constant instantaneous forward rates
+*/
+
+#ifndef quantlib_fdm_constant_forward_hpp
+#define quantlib_fdm_constant_forward_hpp
+
+#include <ql/termstructures/yieldtermstructure.hpp>
+
+namespace QuantLib {
+
+    //! whether the instantaneous forward rate of the curve is constant
+    /*! Operators use this to detect time-homogeneous coefficients.
+        Only a FlatForward curve with continuous or periodic
+        compounding qualifies; e.g., a flat simple rate implies a
+        forward decreasing with time.  Other curves are conservatively
+        taken as time-dependent.
+    */
+    bool fdmHasConstantForward(const std::shared_ptr<YieldTermStructure>& ts);
+
+}
+
+#endif
@@ -31,29 +31,26 @@ namespace QuantLib {
     }
 
     Real FdmMesherIntegral::integrate(const Array& f) const {
-        const Array x(meshers_.back()->locations().begin(),
-                      meshers_.back()->locations().end());
-
-        if (meshers_.size() == 1) {
-            return integrator1d_(x, f);
-        }
-
-        const std::shared_ptr<FdmMesherComposite> subMesher =
-            std::make_shared<FdmMesherComposite>(std::vector<std::shared_ptr<Fdm1dMesher>>(
-                                                 meshers_.begin(), meshers_.end()-1));
-
-        FdmMesherIntegral subMesherIntegral(subMesher, integrator1d_);
-        const Size subSize = subMesher->layout()->size();
-
-        Array g(x.size()), fSub(subSize);
-
-        for (Size i=0; i < x.size(); ++i) {
-            std::copy(f.begin() + i    *subSize,
-                      f.begin() + (i+1)*subSize, fSub.begin());
-
-            g[i] = subMesherIntegral.integrate(fSub);
+        // The lines along the first direction are contiguous blocks of
+        // f, and their integrals form a function of the remaining
+        // directions with the same layout; therefore the directions
+        // can be integrated out one after the other.
+        Array g = f;
+        for (Size d=0; d < meshers_.size()-1; ++d) {
+            const Array x(meshers_[d]->locations().begin(),
+                          meshers_[d]->locations().end());
+
+            const Size n = x.size();
+            Array line(n), h(g.size()/n);
+            for (Size l=0; l < h.size(); ++l) {
+                std::copy(g.begin() + l*n, g.begin() + (l+1)*n, line.begin());
+                h[l] = integrator1d_(x, line);
+            }
+            g.swap(h);
         }
 
+        const Array x(meshers_.back()->locations().begin(),
+                      meshers_.back()->locations().end());
         return integrator1d_(x, g);
     }
 }
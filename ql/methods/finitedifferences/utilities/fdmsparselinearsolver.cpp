@@ -0,0 +1,178 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file fdmsparselinearsolver.cpp
+    \brief sparse solver for implicit finite-difference steps
+*/
+
+#include <ql/methods/finitedifferences/utilities/fdmsparselinearsolver.hpp>
+#include <ql/utilities/null.hpp>
+#include <numeric>
+
+namespace QuantLib {
+
+    FdmSparseLinearSolver::FdmSparseLinearSolver(
+        std::shared_ptr<FdmLinearOpComposite> map,
+        Real relTol,
+        Real refactorizationThreshold)
+    : map_(std::move(map)), relTol_(relTol),
+      refactorizationThreshold_(refactorizationThreshold) {}
+
+    void FdmSparseLinearSolver::setStep(Time dt) {
+        const SparseMatrix m = map_->toMatrix();
+        const Size n = m.row_size();
+
+        std::vector<Size> rawStart(n+1, 0), rawColumns;
+        std::vector<Real> rawValues;
+        rawColumns.reserve(m.filled_size());
+        rawValues.reserve(m.filled_size());
+        m.for_each_element([&](Size i, Size j, Real v) {
+            ++rawStart[i+1];
+            rawColumns.push_back(j);
+            rawValues.push_back(v);
+        });
+        std::partial_sum(rawStart.begin(), rawStart.end(), rawStart.begin());
+
+        // I - dt*L, making sure that each row has a diagonal element
+        std::vector<Size> rowStart(n+1), columns, diagonal(n);
+        std::vector<Real> values;
+        columns.reserve(rawColumns.size() + n);
+        values.reserve(rawColumns.size() + n);
+        for (Size i=0; i < n; ++i) {
+            rowStart[i] = columns.size();
+            bool hasDiagonal = false;
+            for (Size p=rawStart[i]; p < rawStart[i+1]; ++p) {
+                const Size j = rawColumns[p];
+                if (!hasDiagonal && j >= i) {
+                    diagonal[i] = columns.size();
+                    columns.push_back(i);
+                    values.push_back(1.0);
+                    hasDiagonal = true;
+                }
+                if (j == i) {
+                    values[diagonal[i]] -= dt*rawValues[p];
+                } else {
+                    columns.push_back(j);
+                    values.push_back(-dt*rawValues[p]);
+                }
+            }
+            if (!hasDiagonal) {
+                diagonal[i] = columns.size();
+                columns.push_back(i);
+                values.push_back(1.0);
+            }
+        }
+        rowStart[n] = columns.size();
+
+        bool refactorize = factorized_.empty()
+            || rowStart != rowStart_ || columns != columns_;
+
+        rowStart_.swap(rowStart);
+        columns_.swap(columns);
+        diagonal_.swap(diagonal);
+        values_.swap(values);
+
+        if (!refactorize) {
+            Real maxChange = 0.0, maxValue = 0.0;
+            for (Size k=0; k < values_.size(); ++k) {
+                maxChange = std::max(maxChange,
+                                     std::fabs(values_[k] - factorized_[k]));
+                maxValue = std::max(maxValue, std::fabs(factorized_[k]));
+            }
+            refactorize = maxChange > refactorizationThreshold_*maxValue;
+        }
+        if (refactorize)
+            factorize();
+
+        if (!bicgstab_ || rhs_.size() != n) {
+            rhs_ = Array(n);
+            bicgstab_ = std::make_unique<InPlaceBiCGstab>(
+                [this](const Array& x, Array& y) { multiply(x, y); },
+                10*n, relTol_,
+                [this](const Array& b, Array& x) { precondition(b, x); });
+        }
+    }
+
+    void FdmSparseLinearSolver::solve(Array& a) {
+        QL_REQUIRE(bicgstab_, "no step set");
+        QL_REQUIRE(a.size() == rhs_.size(), "inconsistent size of rhs");
+
+        // the right-hand side is the initial guess
+        std::copy(a.begin(), a.end(), rhs_.begin());
+        iterations_ = bicgstab_->solve(rhs_, a);
+    }
+
+    void FdmSparseLinearSolver::factorize() {
+        // ILU(0) in its row-wise (IKJ) variant, see Saad, Yousef,
+        // Iterative methods for sparse linear systems
+        const Size n = diagonal_.size();
+        const Size none = Null<Size>();
+
+        lu_ = values_;
+        position_.assign(n, none);
+        for (Size i=0; i < n; ++i) {
+            for (Size q=rowStart_[i]; q < rowStart_[i+1]; ++q)
+                position_[columns_[q]] = q;
+
+            for (Size p=rowStart_[i]; p < diagonal_[i]; ++p) {
+                const Size k = columns_[p];
+                lu_[p] /= lu_[diagonal_[k]];
+                for (Size q=diagonal_[k]+1; q < rowStart_[k+1]; ++q) {
+                    const Size pos = position_[columns_[q]];
+                    if (pos != none)
+                        lu_[pos] -= lu_[p]*lu_[q];
+                }
+            }
+            QL_REQUIRE(lu_[diagonal_[i]] != 0.0,
+                       "zero pivot in incomplete LU factorization");
+
+            for (Size q=rowStart_[i]; q < rowStart_[i+1]; ++q)
+                position_[columns_[q]] = none;
+        }
+
+        factorized_ = values_;
+        ++factorizations_;
+    }
+
+    void FdmSparseLinearSolver::multiply(const Array& x, Array& y) const {
+        const Size n = diagonal_.size();
+        for (Size i=0; i < n; ++i) {
+            Real s = 0.0;
+            for (Size p=rowStart_[i]; p < rowStart_[i+1]; ++p)
+                s += values_[p]*x[columns_[p]];
+            y[i] = s;
+        }
+    }
+
+    void FdmSparseLinearSolver::precondition(const Array& b, Array& x) const {
+        const Size n = diagonal_.size();
+        // forward substitution with the unit lower triangular factor...
+        for (Size i=0; i < n; ++i) {
+            Real s = b[i];
+            for (Size p=rowStart_[i]; p < diagonal_[i]; ++p)
+                s -= lu_[p]*x[columns_[p]];
+            x[i] = s;
+        }
+        // ...followed by back substitution with the upper one
+        for (Size i=n; i-- > 0;) {
+            Real s = x[i];
+            for (Size p=diagonal_[i]+1; p < rowStart_[i+1]; ++p)
+                s -= lu_[p]*x[columns_[p]];
+            x[i] = s/lu_[diagonal_[i]];
+        }
+    }
+}
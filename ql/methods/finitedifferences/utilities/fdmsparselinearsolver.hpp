@@ -0,0 +1,91 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file fdmsparselinearsolver.hpp
+    \brief sparse solver for implicit finite-difference steps
+*/
+
+#ifndef quantlib_fdm_sparse_linear_solver_hpp
+#define quantlib_fdm_sparse_linear_solver_hpp
+
+#include <ql/math/matrixutilities/bicgstab.hpp>
+#include <ql/methods/finitedifferences/operators/fdmlinearopcomposite.hpp>
+#include <memory>
+
+namespace QuantLib {
+
+    //! sparse solver for implicit finite-difference steps
+    /*! Solves \f$ (I - \Delta t L) x = b \f$, with \f$ L \f$ the
+        operator at its current time.  The operator, including its
+        mixed derivatives, is assembled in compressed sparse row form
+        by setStep(), and the system is solved by BiCGstab
+        preconditioned with an incomplete LU factorization without
+        fill-in, ILU(0), on the pattern of the matrix.
+
+        The factorization is only renewed when the pattern changes
+        or when an element of the matrix has moved by more than the
+        given fraction of the largest element since the last
+        factorization; between time steps with slowly varying
+        coefficients the preconditioner is thus reused.  Solving
+        does not allocate memory once the work arrays are sized.
+    */
+    class FdmSparseLinearSolver {
+      public:
+        explicit FdmSparseLinearSolver(
+            std::shared_ptr<FdmLinearOpComposite> map,
+            Real relTol = 1e-8,
+            Real refactorizationThreshold = 0.05);
+        FdmSparseLinearSolver(const FdmSparseLinearSolver&) = delete;
+        FdmSparseLinearSolver& operator=(const FdmSparseLinearSolver&)
+            = delete;
+
+        //! assembles \f$ I - \Delta t L \f$ at the current operator time
+        void setStep(Time dt);
+        //! solves the system, overwriting the right-hand side \p a
+        void solve(Array& a);
+
+        //! \name Inspectors
+        //@{
+        //! number of incomplete LU factorizations so far
+        Size factorizations() const { return factorizations_; }
+        //! number of BiCGstab iterations of the last solve
+        Size iterations() const { return iterations_; }
+        //@}
+
+      private:
+        void factorize();
+        void multiply(const Array& x, Array& y) const;
+        void precondition(const Array& b, Array& x) const;
+
+        const std::shared_ptr<FdmLinearOpComposite> map_;
+        const Real relTol_, refactorizationThreshold_;
+
+        // compressed sparse row storage of I - dt*L
+        std::vector<Size> rowStart_, columns_, diagonal_;
+        std::vector<Real> values_;
+        // ILU(0) factors on the same pattern, and the matrix they
+        // were computed from
+        std::vector<Real> lu_, factorized_;
+        std::vector<Size> position_;
+
+        Size factorizations_ = 0, iterations_ = 0;
+        Array rhs_;
+        std::unique_ptr<InPlaceBiCGstab> bicgstab_;
+    };
+}
+
+#endif
@@ -0,0 +1,157 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file batchpathgenerator.hpp
+    \brief Generates batches of random paths using a sequence generator
+*/
+
+#ifndef quantlib_montecarlo_batch_path_generator_hpp
+#define quantlib_montecarlo_batch_path_generator_hpp
+
+#include <ql/methods/montecarlo/brownianbridge.hpp>
+#include <ql/methods/montecarlo/pathbatch.hpp>
+#include <ql/stochasticprocess.hpp>
+
+namespace QuantLib {
+
+    //! Generates batches of random paths using a sequence generator
+    /*! Draws the same paths as a PathGenerator built with the same
+        arguments, but several at a time: the random numbers for all
+        paths in the batch are drawn first, and each time step is then
+        performed on all paths at once by means of the
+        StochasticProcess1D::evolveBatch() method.  This replaces one
+        virtual call per step and path with one per step and batch,
+        and lets processes providing a specialized kernel (e.g.,
+        GeneralizedBlackScholesProcess, OrnsteinUhlenbeckProcess and
+        SquareRootProcess) evolve the whole batch in a tight loop.
+
+        \ingroup mcarlo
+    */
+    template <class GSG>
+    class BatchPathGenerator {
+      public:
+        typedef PathBatch sample_type;
+        BatchPathGenerator(const std::shared_ptr<StochasticProcess>&,
+                           const TimeGrid& timeGrid,
+                           const GSG& generator,
+                           bool brownianBridge);
+        //! \name inspectors
+        //@{
+        //! draws the given number of paths
+        const PathBatch& next(Size paths) const;
+        //! antithetic paths of the batch last returned by next()
+        const PathBatch& antithetic() const;
+        Size size() const { return dimension_; }
+        const TimeGrid& timeGrid() const { return timeGrid_; }
+        //@}
+      private:
+        void evolve(PathBatch& batch, bool antithetic) const;
+        bool brownianBridge_;
+        GSG generator_;
+        Size dimension_;
+        TimeGrid timeGrid_;
+        std::shared_ptr<StochasticProcess1D> process_;
+        mutable PathBatch next_, antithetic_;
+        // random increments, stored by time step like the paths
+        mutable std::vector<Real> dw_;
+        mutable std::vector<Real> temp_;
+        // negated increments of a time step, for antithetic paths
+        mutable std::vector<Real> negated_;
+        BrownianBridge bb_;
+    };
+
+
+    // template definitions
+
+    template <class GSG>
+    BatchPathGenerator<GSG>::BatchPathGenerator(
+                          const std::shared_ptr<StochasticProcess>& process,
+                          const TimeGrid& timeGrid,
+                          const GSG& generator,
+                          bool brownianBridge)
+    : brownianBridge_(brownianBridge), generator_(generator),
+      dimension_(generator_.dimension()), timeGrid_(timeGrid),
+      process_(std::dynamic_pointer_cast<StochasticProcess1D>(process)),
+      next_(timeGrid_), antithetic_(timeGrid_), bb_(timeGrid_) {
+        QL_REQUIRE(process_, "single-factor process required");
+        QL_REQUIRE(dimension_==timeGrid_.size()-1,
+                   "sequence generator dimensionality (" << dimension_
+                   << ") != timeSteps (" << timeGrid_.size()-1 << ")");
+    }
+
+    template <class GSG>
+    const PathBatch& BatchPathGenerator<GSG>::next(Size paths) const {
+        QL_REQUIRE(paths > 0, "empty batch requested");
+        next_.resize(paths);
+        dw_.resize(dimension_*paths);
+
+        // the variates are stored by time step, and bridged
+        // for all paths at once if required
+        if (brownianBridge_)
+            temp_.resize(dimension_*paths);
+        Real* variates = brownianBridge_ ? temp_.data() : dw_.data();
+        typedef typename GSG::sample_type sequence_type;
+        for (Size j=0; j<paths; ++j) {
+            const sequence_type& sequence = generator_.nextSequence();
+            for (Size i=0; i<dimension_; ++i)
+                variates[i*paths + j] = sequence.value[i];
+            next_.weight(j) = sequence.weight;
+        }
+        if (brownianBridge_)
+            bb_.transformBatch(temp_.data(), dw_.data(), paths);
+
+        evolve(next_, false);
+        return next_;
+    }
+
+    template <class GSG>
+    const PathBatch& BatchPathGenerator<GSG>::antithetic() const {
+        Size paths = next_.size();
+        QL_REQUIRE(paths > 0, "no batch drawn yet");
+        antithetic_.resize(paths);
+        for (Size j=0; j<paths; ++j)
+            antithetic_.weight(j) = next_.weight(j);
+        evolve(antithetic_, true);
+        return antithetic_;
+    }
+
+    template <class GSG>
+    void BatchPathGenerator<GSG>::evolve(PathBatch& batch,
+                                         bool antithetic) const {
+        Size paths = batch.size();
+        std::fill(batch.values(0), batch.values(0) + paths, process_->x0());
+
+        if (antithetic)
+            negated_.resize(paths);
+        for (Size i=1; i<batch.length(); ++i) {
+            Time t = timeGrid_[i-1];
+            Time dt = timeGrid_.dt(i-1);
+            const Real* dw = dw_.data() + (i-1)*paths;
+            if (antithetic) {
+                for (Size j=0; j<paths; ++j)
+                    negated_[j] = -dw[j];
+                dw = negated_.data();
+            }
+            process_->evolveBatch(t, dt, paths,
+                                  batch.values(i-1), dw, batch.values(i));
+        }
+    }
+
+}
+
+
+#endif
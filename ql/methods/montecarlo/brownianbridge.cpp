@@ -109,5 +109,41 @@ namespace QuantLib {
         }
     }
 
-}
+    void BrownianBridge::transformBatch(const Real* input, Real* output,
+                                        Size samples) const {
+        // We use output to store the paths...
+        Real* last = output + (size_-1)*samples;
+        for (Size p=0; p<samples; ++p)
+            last[p] = stdDev_[0] * input[p];
+        for (Size i=1; i<size_; ++i) {
+            Size j = leftIndex_[i];
+            Size k = rightIndex_[i];
+            Size l = bridgeIndex_[i];
+            const Real* z = input + i*samples;
+            const Real* right = output + k*samples;
+            Real* point = output + l*samples;
+            Real wl = leftWeight_[i], wr = rightWeight_[i], s = stdDev_[i];
+            if (j != 0) {
+                const Real* left = output + (j-1)*samples;
+                for (Size p=0; p<samples; ++p)
+                    point[p] = wl * left[p] + wr * right[p] + s * z[p];
+            } else {
+                for (Size p=0; p<samples; ++p)
+                    point[p] = wr * right[p] + s * z[p];
+            }
+        }
+        // ...after which, we calculate the variations and
+        // normalize to unit times
+        for (Size i=size_-1; i>=1; --i) {
+            Real* current = output + i*samples;
+            const Real* previous = current - samples;
+            for (Size p=0; p<samples; ++p) {
+                current[p] -= previous[p];
+                current[p] /= sqrtdt_[i];
+            }
+        }
+        for (Size p=0; p<samples; ++p)
+            output[p] /= sqrtdt_[0];
+    }
 
+}
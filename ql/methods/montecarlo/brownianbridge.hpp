@@ -135,6 +135,26 @@ namespace QuantLib {
             }
             output[0] /= sqrtdt_[0];
         }
+
+        //! Brownian-bridge generator function for several samples
+        /*! Transforms a number of input sequences at once; the
+            results are the same that would be obtained by calling
+            the single-sequence transform on each of them.
+
+            \param input   The input sequences, stored by variate:
+                           the i-th variate of the p-th sample is
+                           <tt>input[i*samples+p]</tt>.
+            \param output  The output sequences, stored in the same
+                           way; it must not overlap the input.
+            \param samples The number of samples.
+
+            Storing the sequences by variate allows the inner loops
+            to run over the samples with unit stride, so that the
+            index indirection is paid once per variate instead of
+            once per variate and sample.
+        */
+        void transformBatch(const Real* input, Real* output,
+                            Size samples) const;
       private:
         void initialize();
         Size size_;
@@ -18,8 +18,8 @@
 */
 
 #include <ql/methods/montecarlo/genericlsregression.hpp>
-#include <ql/math/statistics/sequencestatistics.hpp>
-#include <ql/math/matrixutilities/svd.hpp>
+#include <ql/math/generallinearleastsquares.hpp>
+#include <ql/math/statistics/statistics.hpp>
 
 namespace QuantLib {
 
@@ -34,38 +34,31 @@ namespace QuantLib {
 
             std::vector<NodeData>& exerciseData = simulationData[i];
 
-            // 1) find the covariance matrix of basis function values and
-            //    deflated cash-flows
+            // 1) fill the design matrix with the basis function values
+            //    and the target with the deflated cash-flows
             Size N = exerciseData.front().values.size();
-            std::vector<Real> temp(N+1);
-            SequenceStatistics stats(N+1);
-
+            Size valid = 0;
             Size j;
             for (j=0; j<exerciseData.size(); ++j) {
+                if (exerciseData[j].isValid)
+                    ++valid;
+            }
+
+            Matrix design(valid, N);
+            Array target(valid);
+            for (j=0, valid=0; j<exerciseData.size(); ++j) {
                 if (exerciseData[j].isValid) {
                     std::copy(exerciseData[j].values.begin(),
                               exerciseData[j].values.end(),
-                              temp.begin());
-                    temp.back() = exerciseData[j].cumulatedCashFlows
-                                - exerciseData[j].controlValue;
-
-                    stats.add(temp);
+                              design.row_begin(valid));
+                    target[valid++] = exerciseData[j].cumulatedCashFlows
+                                    - exerciseData[j].controlValue;
                 }
             }
 
-            std::vector<Real> means = stats.mean();
-            Matrix covariance = stats.covariance();
-
-            Matrix C(N,N);
-            Array target(N);
-            for (Size k=0; k<N; ++k) {
-                target[k] = covariance[k][N] + means[k]*means[N];
-                for (Size l=0; l<=k; ++l)
-                    C[k][l] = C[l][k] = covariance[k][l] + means[k]*means[l];
-            }
-
             // 2) solve for least squares regression
-            Array alphas = SVD(C).solveFor(target);
+            Array alphas =
+                GeneralLinearLeastSquares(design, target).coefficients();
             basisCoefficients[i-1].resize(N);
             std::copy(alphas.begin(), alphas.end(),
                       basisCoefficients[i-1].begin());
@@ -29,14 +29,95 @@
 #include <ql/termstructures/yieldtermstructure.hpp>
 #include <ql/math/functional.hpp>
 #include <ql/math/generallinearleastsquares.hpp>
+#include <ql/math/matrixutilities/choleskydecomposition.hpp>
+#include <ql/math/matrixutilities/qrdecomposition.hpp>
 #include <ql/math/statistics/incrementalstatistics.hpp>
 #include <ql/methods/montecarlo/pathpricer.hpp>
 #include <ql/methods/montecarlo/earlyexercisepathpricer.hpp>
+#include <ql/methods/montecarlo/pathpool.hpp>
 
+#include <algorithm>
 #include <functional>
+#include <numeric>
 
 namespace QuantLib {
 
+    namespace detail {
+
+        // flat storage of regression states
+        inline Size lsmStateSize(Real) { return 1; }
+        inline Size lsmStateSize(const Array& state) { return state.size(); }
+
+        inline void lsmStoreState(Real state, std::vector<Real>& buffer) {
+            buffer.push_back(state);
+        }
+        inline void lsmStoreState(const Array& state,
+                                  std::vector<Real>& buffer) {
+            buffer.insert(buffer.end(), state.begin(), state.end());
+        }
+
+        inline void lsmLoadState(const Real* begin, Size, Real& state) {
+            state = *begin;
+        }
+        inline void lsmLoadState(const Real* begin, Size size, Array& state) {
+            if (state.size() != size)
+                state = Array(size);
+            std::copy(begin, begin+size, state.begin());
+        }
+
+        // scratch path with the shape of the paths in a pool
+        inline Path lsmScratchPath(const PathPool& pool, const Path*) {
+            return Path(pool.timeGrid());
+        }
+        inline MultiPath lsmScratchPath(const PathPool& pool,
+                                        const MultiPath*) {
+            return MultiPath(pool.assetNumber(), pool.timeGrid());
+        }
+
+        // solves the normal equations A x = b of a regression
+        inline Array lsmNormalEquationsSolve(Matrix& a, Array& b) {
+            const Size k = b.size();
+            // equilibrate the system to reduce its condition number
+            Array scale(k);
+            for (Size i=0; i<k; ++i)
+                scale[i] = a[i][i] > 0.0 ? 1.0/std::sqrt(a[i][i]) : 1.0;
+            for (Size i=0; i<k; ++i) {
+                for (Size j=0; j<k; ++j)
+                    a[i][j] *= scale[i]*scale[j];
+                b[i] *= scale[i];
+            }
+
+            Array x(k);
+            Matrix l = CholeskyDecomposition(a, true);
+            bool singular = false;
+            for (Size i=0; i<k && !singular; ++i)
+                singular = (l[i][i] < 1.0e-6);
+            if (!singular) {
+                // forward and backward substitution
+                for (Size i=0; i<k; ++i) {
+                    Real sum = b[i];
+                    for (Size j=0; j<i; ++j)
+                        sum -= l[i][j]*x[j];
+                    x[i] = sum/l[i][i];
+                }
+                for (Size i=k; i>0; --i) {
+                    Real sum = x[i-1];
+                    for (Size j=i; j<k; ++j)
+                        sum -= l[j][i-1]*x[j];
+                    x[i-1] = sum/l[i-1][i-1];
+                }
+            } else {
+                // e.g., collinear basis functions over the sample
+                x = qrSolve(a, b);
+            }
+
+            for (Size i=0; i<k; ++i)
+                x[i] *= scale[i];
+            return x;
+        }
+
+    }
+
     //! Longstaff-Schwarz path pricer for early exercise options
     /*! References:
 
@@ -44,6 +125,26 @@ namespace QuantLib {
         by Simulation: A Simple Least-Squares Approach, The Review of
         Financial Studies, Volume 14, No. 1, 113-147
 
+        By default, the calibration paths are stored in a PathPool,
+        i.e., in a single buffer not requiring an allocation per
+        path, and the regressions are performed by singular value
+        decomposition.
+        In streaming mode, no calibration path is stored.  The
+        calibration paths are generated again for each exercise date,
+        from the last to the first (see calibrationPasses()); while
+        they are drawn, each path is rolled back to the date with the
+        exercise policy found so far, and the normal equations of the
+        regression at the date are accumulated.  They are solved by a
+        Cholesky decomposition at the end of the pass.  Memory usage
+        is thus independent of the number of paths, at the price of
+        generating the paths once per exercise date and of a lower
+        accuracy for ill-conditioned basis systems.
+
+        The regression uses the basis system of the early-exercise
+        path pricer unless a basis set (e.g., LsmPathBasisSet or
+        LsmMultiPathBasisSet) is passed; the latter evaluates all the
+        basis functions for a state at once.
+
         \ingroup mcarlo
 
         \test the correctness of the returned value is tested by
@@ -57,14 +158,50 @@ namespace QuantLib {
         LongstaffSchwartzPathPricer(
             const TimeGrid& times,
             const std::shared_ptr<EarlyExercisePathPricer<PathType> >& ,
-            const std::shared_ptr<YieldTermStructure>& termStructure);
+            const std::shared_ptr<YieldTermStructure>& termStructure,
+            bool streamingCalibration = false);
+
+        template <class BasisSet,
+                  class = typename std::enable_if<std::is_same<
+                      typename BasisSet::argument_type, StateType>::value
+                  >::type>
+        LongstaffSchwartzPathPricer(
+            const TimeGrid& times,
+            const std::shared_ptr<EarlyExercisePathPricer<PathType> >&
+                pathPricer,
+            const std::shared_ptr<YieldTermStructure>& termStructure,
+            const BasisSet&,
+            bool streamingCalibration = false)
+        : LongstaffSchwartzPathPricer(times, pathPricer, termStructure,
+                                      streamingCalibration) {
+            basisSet_ = [](const StateType& state, Real* values) {
+                BasisSet::evaluate(state, values);
+            };
+            basisValues_.resize(BasisSet::size());
+            if (streaming_)
+                resetNormalEquations();
+        }
 
         Real operator()(const PathType& path) const;
+        /*! In streaming mode, this ends a calibration pass and solves
+            the regression at the corresponding exercise date.
+        */
         virtual void calibrate();
+        //! number of passes over the calibration paths
+        /*! In streaming mode, the same calibration paths must be
+            passed once for each exercise date, each pass followed by
+            a call to calibrate(); otherwise, a single pass is needed.
+        */
+        Size calibrationPasses() const {
+            return streaming_ ? std::max<Size>(len_-2, 1) : 1;
+        }
 
         Real exerciseProbability() const;
 
       protected:
+        /*! \warning not called in streaming mode, where the values
+                     on the single paths are not available.
+        */
         virtual void post_processing(const Size i,
                                      const std::vector<StateType> &state,
                                      const std::vector<Real> &price,
@@ -78,10 +215,40 @@ namespace QuantLib {
         std::vector<Array> coeff_;
         std::vector<DiscountFactor> dF_;
 
-        mutable std::vector<PathType> paths_;
+        mutable PathPool paths_;
         const   std::vector<std::function<Real(const StateType&)>> v_;
 
         const Size len_;
+
+      private:
+        void calibrateFromPool();
+        void solveCalibrationPass();
+        void resetNormalEquations() {
+            const Size k = basisSize();
+            xtx_ = Matrix(k, k, 0.0);
+            xty_ = Array(k, 0.0);
+            itm_ = 0;
+        }
+        Size basisSize() const { return basisValues_.size(); }
+        void evaluateBasis(const StateType& state) const {
+            if (basisSet_) {
+                basisSet_(state, basisValues_.data());
+            } else {
+                for (Size l=0; l<v_.size(); ++l)
+                    basisValues_[l] = v_[l](state);
+            }
+        }
+
+        const bool streaming_;
+        // streaming mode: exercise date of the current pass and normal
+        // equations of its regression (lower triangle of xtx_)
+        Size calibrationDate_;
+        mutable Matrix xtx_;
+        mutable Array xty_;
+        mutable Size itm_;
+        // basis set, if any, and buffer for the basis values
+        void (*basisSet_)(const StateType&, Real*);
+        mutable std::vector<Real> basisValues_;
     };
 
     template <class PathType> inline
@@ -89,36 +256,49 @@ namespace QuantLib {
         const TimeGrid& times,
         const std::shared_ptr<EarlyExercisePathPricer<PathType> >&
             pathPricer,
-        const std::shared_ptr<YieldTermStructure>& termStructure)
+        const std::shared_ptr<YieldTermStructure>& termStructure,
+        bool streamingCalibration)
     : calibrationPhase_(true),
       pathPricer_(pathPricer),
       coeff_     (std::vector<Array>(times.size()-2)),
       dF_        (std::vector<DiscountFactor>(times.size()-1)),
       v_         (pathPricer_->basisSystem()),
-      len_       (times.size()) {
+      len_       (times.size()),
+      streaming_ (streamingCalibration),
+      calibrationDate_(len_-2),
+      itm_       (0),
+      basisSet_  (nullptr),
+      basisValues_(v_.size()) {
 
         for (Size i=0; i<times.size()-1; ++i) {
             dF_[i] =   termStructure->discount(times[i+1])
                      / termStructure->discount(times[i]);
         }
+
+        if (streaming_)
+            resetNormalEquations();
     }
 
     template <class PathType> inline
     Real LongstaffSchwartzPathPricer<PathType>::operator()
         (const PathType& path) const {
-        if (calibrationPhase_) {
+        if (calibrationPhase_ && !streaming_) {
             // store paths for the calibration
-            paths_.emplace_back(path);
+            paths_.add(path);
             // result doesn't matter
             return 0.0;
         }
 
+        // during a calibration pass, the path is only rolled back
+        // to the exercise date of the pass
+        const Size last = calibrationPhase_ ? calibrationDate_ : 0;
+
         Real price = (*pathPricer_)(path, len_-1);
 
         // Initialize with exercise on last date
         bool exercised = (price > 0.0);
 
-        for (Size i=len_-2; i>0; --i) {
+        for (Size i=len_-2; i>last; --i) {
             price*=dF_[i];
 
             const Real exercise = (*pathPricer_)(path, i);
@@ -126,8 +306,14 @@ namespace QuantLib {
                 const StateType regValue = pathPricer_->state(path, i);
 
                 Real continuationValue = 0.0;
-                for (Size l=0; l<v_.size(); ++l) {
-                    continuationValue += coeff_[i-1][l] * v_[l](regValue);
+                if (basisSet_) {
+                    basisSet_(regValue, basisValues_.data());
+                    for (Size l=0; l<basisValues_.size(); ++l)
+                        continuationValue += coeff_[i-1][l] * basisValues_[l];
+                } else {
+                    for (Size l=0; l<v_.size(); ++l) {
+                        continuationValue += coeff_[i-1][l] * v_[l](regValue);
+                    }
                 }
 
                 if (continuationValue < exercise) {
@@ -139,6 +325,24 @@ namespace QuantLib {
             }
         }
 
+        if (calibrationPhase_) {
+            // accumulate the normal equations of the regression of
+            // the discounted price on the basis functions
+            if (last > 0 && (*pathPricer_)(path, last) > 0.0) {
+                price *= dF_[last];
+                evaluateBasis(pathPricer_->state(path, last));
+                const Size k = basisSize();
+                for (Size l=0; l<k; ++l) {
+                    for (Size r=0; r<=l; ++r)
+                        xtx_[l][r] += basisValues_[l]*basisValues_[r];
+                    xty_[l] += basisValues_[l]*price;
+                }
+                ++itm_;
+            }
+            // result doesn't matter
+            return 0.0;
+        }
+
         exerciseProbability_.add(exercised ? 1.0 : 0.0);
 
         return price*dF_[0];
@@ -146,56 +350,104 @@ namespace QuantLib {
 
     template <class PathType> inline
     void LongstaffSchwartzPathPricer<PathType>::calibrate() {
+        if (streaming_)
+            solveCalibrationPass();
+        else
+            calibrateFromPool();
+    }
+
+    template <class PathType> inline
+    void LongstaffSchwartzPathPricer<PathType>::calibrateFromPool() {
+
+        // exercise values and states of the stored paths, computed
+        // in a single pass over the pool; the values of the j-th path
+        // at the i-th time are stored at position j*m+i-1 (times d
+        // for the states)
         const Size n = paths_.size();
+        const Size m = len_-1;
+        std::vector<Real> exerciseValues(n*m), states;
+        Size d = 0;
+        if (n > 0) {
+            PathType path = detail::lsmScratchPath(
+                                paths_, static_cast<PathType*>(nullptr));
+            for (Size j=0; j<n; ++j) {
+                paths_.copy(j, path);
+                for (Size i=1; i<len_; ++i) {
+                    exerciseValues[j*m+i-1] = (*pathPricer_)(path, i);
+                    const StateType state = pathPricer_->state(path, i);
+                    d = detail::lsmStateSize(state);
+                    detail::lsmStoreState(state, states);
+                }
+            }
+        }
+
+        // remove calibration paths and release memory
+        paths_.release();
+
         Array prices(n), exercise(n);
         std::vector<StateType> p_state(n);
         std::vector<Real> p_price(n), p_exercise(n);
 
-        for (Size i=0; i<n; ++i) {
-            p_state[i] = pathPricer_->state(paths_[i],len_-1);
-            prices[i] = p_price[i] = (*pathPricer_)(paths_[i], len_-1);
-            p_exercise[i] = prices[i];
+        for (Size j=0; j<n; ++j) {
+            detail::lsmLoadState(&states[(j*m+m-1)*d], d, p_state[j]);
+            prices[j] = p_price[j] = exerciseValues[j*m+m-1];
+            p_exercise[j] = prices[j];
         }
 
         post_processing(len_ - 1, p_state, p_price, p_exercise);
 
-        std::vector<Real>      y;
-        std::vector<StateType> x;
+        const Size k = basisSize();
+        std::vector<Real> y;
+        StateType state;
         for (Size i=len_-2; i>0; --i) {
-            y.clear();
-            x.clear();
-
             //roll back step
+            Size itm = 0;
             for (Size j=0; j<n; ++j) {
-                exercise[j]=(*pathPricer_)(paths_[j], i);
+                exercise[j]=exerciseValues[j*m+i-1];
+                if (exercise[j]>0.0)
+                    ++itm;
+            }
+
+            // values of the basis functions on the in-the-money paths
+            Matrix design(itm, k);
+            y.resize(itm);
+            for (Size j=0, r=0; j<n; ++j) {
                 if (exercise[j]>0.0) {
-                    x.emplace_back(pathPricer_->state(paths_[j], i));
-                    y.emplace_back(dF_[i]*prices[j]);
+                    detail::lsmLoadState(&states[(j*m+i-1)*d], d, state);
+                    Real* row = &*design.row_begin(r);
+                    if (basisSet_) {
+                        basisSet_(state, row);
+                    } else {
+                        for (Size l=0; l<k; ++l)
+                            row[l] = v_[l](state);
+                    }
+                    y[r++] = dF_[i]*prices[j];
                 }
             }
 
-            if (v_.size() <=  x.size()) {
-                coeff_[i-1] = GeneralLinearLeastSquares(x, y, v_).coefficients();
+            if (k <= itm) {
+                coeff_[i-1] =
+                    GeneralLinearLeastSquares(design, y).coefficients();
             }
             else {
             // if number of itm paths is smaller then the number of
             // calibration functions then early exercise if exerciseValue > 0
-                coeff_[i-1] = Array(v_.size(), 0.0);
+                coeff_[i-1] = Array(k, 0.0);
             }
 
-            for (Size j=0, k=0; j<n; ++j) {
+            for (Size j=0, r=0; j<n; ++j) {
                 prices[j]*=dF_[i];
                 if (exercise[j]>0.0) {
-                    Real continuationValue = 0.0;
-                    for (Size l=0; l<v_.size(); ++l) {
-                        continuationValue += coeff_[i-1][l] * v_[l](x[k]);
-                    }
+                    const Real continuationValue =
+                        std::inner_product(design.row_begin(r),
+                                           design.row_end(r),
+                                           coeff_[i-1].begin(), Real(0.0));
                     if (continuationValue < exercise[j]) {
                         prices[j] = exercise[j];
                     }
-                    ++k;
+                    ++r;
                 }
-                p_state[j] = pathPricer_->state(paths_[j],i);
+                detail::lsmLoadState(&states[(j*m+i-1)*d], d, p_state[j]);
                 p_price[j] = prices[j];
                 p_exercise[j] = exercise[j];
             }
@@ -203,13 +455,41 @@ namespace QuantLib {
             post_processing(i, p_state, p_price, p_exercise);
         }
 
-        // remove calibration paths and release memory
-        std::vector<PathType> empty;
-        paths_.swap(empty);
         // entering the calculation phase
         calibrationPhase_ = false;
     }
 
+    template <class PathType> inline
+    void LongstaffSchwartzPathPricer<PathType>::solveCalibrationPass() {
+        const Size i = calibrationDate_;
+        if (i > 0) {
+            const Size k = basisSize();
+            if (k <= itm_) {
+                for (Size l=0; l<k; ++l)
+                    for (Size r=0; r<l; ++r)
+                        xtx_[r][l] = xtx_[l][r];
+                coeff_[i-1] = detail::lsmNormalEquationsSolve(xtx_, xty_);
+            }
+            else {
+            // if number of itm paths is smaller then the number of
+            // calibration functions then early exercise if exerciseValue > 0
+                coeff_[i-1] = Array(k, 0.0);
+            }
+            calibrationDate_ = i-1;
+        }
+
+        if (calibrationDate_ > 0) {
+            // prepare the next pass
+            resetNormalEquations();
+        } else {
+            // release memory
+            xtx_ = Matrix();
+            xty_ = Array();
+            // entering the calculation phase
+            calibrationPhase_ = false;
+        }
+    }
+
     template <class PathType> inline
     Real LongstaffSchwartzPathPricer<PathType>::exerciseProbability() const {
         return exerciseProbability_.mean();
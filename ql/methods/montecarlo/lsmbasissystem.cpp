@@ -107,6 +107,23 @@ namespace QuantLib {
         }
     }
 
+    namespace detail {
+
+        std::vector<Size> lsmMultiIndices(Size dim, Size order) {
+            QL_REQUIRE(dim > 0, "zero dimension");
+            // 0-th order term
+            std::vector<Size> ret(dim, 0);
+            VV tuples(1, std::vector<Size>(dim));
+            for (Size i = 1; i <= order; ++i) {
+                tuples = next_order_tuples(tuples);
+                for (Size j = 0; j < tuples.size(); ++j)
+                    ret.insert(ret.end(), tuples[j].begin(), tuples[j].end());
+            }
+            return ret;
+        }
+
+    }
+
     // LsmBasisSystem static methods
 
     VF_R LsmBasisSystem::pathBasisSystem(Size order, PolynomType polyType) {
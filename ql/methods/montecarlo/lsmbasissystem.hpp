@@ -29,6 +29,8 @@
 
 #include <ql/qldefines.hpp>
 #include <ql/math/array.hpp>
+#include <ql/math/integrals/gaussianorthogonalpolynomial.hpp>
+#include <cmath>
 #include <functional>
 #include <vector>
 
@@ -45,6 +47,171 @@ namespace QuantLib {
     };
 
 
+    namespace detail {
+
+        // three-term recurrences and weights of the polynomials
+        template <LsmBasisSystem::PolynomType Type>
+        struct LsmPolynomialTraits;
+
+        template <>
+        struct LsmPolynomialTraits<LsmBasisSystem::Laguerre> {
+            static Real alpha(Size i) { return 2*i+1; }
+            static Real beta(Size i) { return Real(i)*i; }
+            static Real weight(Real x) { return std::exp(-x); }
+        };
+
+        template <>
+        struct LsmPolynomialTraits<LsmBasisSystem::Hermite> {
+            static Real alpha(Size) { return 0.0; }
+            static Real beta(Size i) { return i/2.0; }
+            static Real weight(Real x) { return std::exp(-x*x); }
+        };
+
+        template <>
+        struct LsmPolynomialTraits<LsmBasisSystem::Hyperbolic> {
+            static Real alpha(Size) { return 0.0; }
+            static Real beta(Size i) { return i ? M_PI_2*M_PI_2*i*i : M_PI; }
+            static Real weight(Real x) { return 1/std::cosh(x); }
+        };
+
+        // the recurrences of the Jacobi polynomials are taken from the
+        // corresponding Gaussian orthogonal polynomials
+        template <class Polynomial>
+        inline Real lsmJacobiBeta(Size i) {
+            static const Polynomial polynomial;
+            return polynomial.beta(i);
+        }
+
+        template <>
+        struct LsmPolynomialTraits<LsmBasisSystem::Legendre> {
+            static Real alpha(Size) { return 0.0; }
+            static Real beta(Size i) {
+                return lsmJacobiBeta<GaussLegendrePolynomial>(i);
+            }
+            static Real weight(Real) { return 1.0; }
+        };
+
+        template <>
+        struct LsmPolynomialTraits<LsmBasisSystem::Chebyshev> {
+            static Real alpha(Size) { return 0.0; }
+            static Real beta(Size i) {
+                return lsmJacobiBeta<GaussChebyshevPolynomial>(i);
+            }
+            static Real weight(Real x) {
+                return std::pow(1-x, -0.5)*std::pow(1+x, -0.5);
+            }
+        };
+
+        template <>
+        struct LsmPolynomialTraits<LsmBasisSystem::Chebyshev2nd> {
+            static Real alpha(Size) { return 0.0; }
+            static Real beta(Size i) {
+                return lsmJacobiBeta<GaussChebyshev2ndPolynomial>(i);
+            }
+            static Real weight(Real x) {
+                return std::pow(1-x, 0.5)*std::pow(1+x, 0.5);
+            }
+        };
+
+        // number of monomials of the given dimension up to the given order
+        constexpr Size lsmBasisSize(Size dim, Size order) {
+            return order == 0 ? 1 :
+                lsmBasisSize(dim, order-1) * (dim+order) / order;
+        }
+
+        /* exponents of the terms of LsmBasisSystem::multiPathBasisSystem,
+           dim of them for each term, in the same order */
+        std::vector<Size> lsmMultiIndices(Size dim, Size order);
+
+    }
+
+
+    //! univariate basis functions of fixed type and order
+    /*! The basis set evaluates the same functions as
+        LsmBasisSystem::pathBasisSystem(Order, Type), but all at once
+        and in a single inlined loop instead of one indirect call for
+        each function.  It can be used by LongstaffSchwartzPathPricer
+        in place of the basis system of the early-exercise path pricer,
+        or to fill the basis values of NodeData for
+        genericLongstaffSchwartzRegression.
+    */
+    template <LsmBasisSystem::PolynomType Type, Size Order>
+    class LsmPathBasisSet {
+      public:
+        typedef Real argument_type;
+        static constexpr Size size() { return Order+1; }
+        //! writes the values of the basis functions to values[0..size())
+        static void evaluate(Real x, Real* values) {
+            typedef detail::LsmPolynomialTraits<Type> traits;
+            const Real w = std::sqrt(traits::weight(x));
+            Real p0 = 1.0, p1 = x - traits::alpha(0);
+            values[0] = w;
+            if (Order > 0)
+                values[1] = w*p1;
+            for (Size n=2; n<=Order; ++n) {
+                const Real p = (x-traits::alpha(n-1))*p1
+                             - traits::beta(n-1)*p0;
+                values[n] = w*p;
+                p0 = p1;
+                p1 = p;
+            }
+        }
+    };
+
+    template <Size Order>
+    class LsmPathBasisSet<LsmBasisSystem::Monomial, Order> {
+      public:
+        typedef Real argument_type;
+        static constexpr Size size() { return Order+1; }
+        static void evaluate(Real x, Real* values) {
+            values[0] = 1.0;
+            for (Size n=1; n<=Order; ++n)
+                values[n] = values[n-1]*x;
+        }
+    };
+
+
+    //! multivariate basis functions of fixed type, order and dimension
+    /*! The basis set evaluates the same functions as
+        LsmBasisSystem::multiPathBasisSystem(Dim, Order, Type); the
+        univariate functions are evaluated once for each coordinate
+        and their products are written to the caller's buffer, without
+        allocating.
+    */
+    template <LsmBasisSystem::PolynomType Type, Size Order, Size Dim>
+    class LsmMultiPathBasisSet {
+        static_assert(Dim > 0, "zero dimension");
+      public:
+        typedef Array argument_type;
+        static constexpr Size size() {
+            return detail::lsmBasisSize(Dim, Order);
+        }
+        //! writes the values of the basis functions to values[0..size())
+        static void evaluate(const Real* x, Real* values) {
+            Real univariate[Dim][Order+1];
+            for (Size k=0; k<Dim; ++k)
+                LsmPathBasisSet<Type,Order>::evaluate(x[k], univariate[k]);
+            const Size* e = exponents();
+            for (Size i=0; i<size(); ++i, e+=Dim) {
+                Real value = univariate[0][e[0]];
+                for (Size k=1; k<Dim; ++k)
+                    value *= univariate[k][e[k]];
+                values[i] = value;
+            }
+        }
+        static void evaluate(const Array& x, Real* values) {
+            QL_REQUIRE(x.size() == Dim, "wrong argument size");
+            evaluate(x.data(), values);
+        }
+      private:
+        static const Size* exponents() {
+            static const std::vector<Size> exponents =
+                detail::lsmMultiIndices(Dim, Order);
+            return exponents.data();
+        }
+    };
+
+
 }
 
 #endif
@@ -26,9 +26,13 @@
 #define quantlib_montecarlo_model_hpp
 
 #include <ql/methods/montecarlo/mctraits.hpp>
+#include <ql/methods/montecarlo/pathbatch.hpp>
 #include <ql/math/statistics/statistics.hpp>
+#include <ql/utilities/threadpool.hpp>
 #include <memory>
 #include <algorithm>
+#include <functional>
+#include <vector>
 
 namespace QuantLib {
 
@@ -58,7 +62,7 @@ namespace QuantLib {
         typedef typename path_generator_type::sample_type sample_type;
         typedef typename path_pricer_type::result_type result_type;
         typedef S stats_type;
-        // constructor
+        // constructors
         MonteCarloModel(
                   const std::shared_ptr<path_generator_type>& pathGenerator,
                   const std::shared_ptr<path_pricer_type>& pathPricer,
@@ -69,66 +73,247 @@ namespace QuantLib {
                   result_type cvOptionValue = result_type(),
                   const std::shared_ptr<path_generator_type>& cvPathGenerator
                         = std::shared_ptr<path_generator_type>())
-        : pathGenerator_(pathGenerator), pathPricer_(pathPricer),
+        : pathGenerators_(1, pathGenerator), pathPricers_(1, pathPricer),
           sampleAccumulator_(sampleAccumulator),
           isAntitheticVariate_(antitheticVariate),
-          cvPathPricer_(cvPathPricer), cvOptionValue_(cvOptionValue),
+          cvPathPricers_(1, cvPathPricer), cvOptionValue_(cvOptionValue),
           cvPathGenerator_(cvPathGenerator) {
-            if (!cvPathPricer_)
+            if (!cvPathPricer)
                 isControlVariate_ = false;
             else
                 isControlVariate_ = true;
         }
+        /*! Multi-threaded model: each thread uses its own path
+            generator, path pricer and (if given) control-variate path
+            pricer, which are therefore not required to be thread-safe.
+
+            Each batch of samples is split among threads in contiguous
+            blocks (see threadSamples() and firstThreadSample()); the
+            samples are added to the accumulator in thread order, so
+            that results are reproducible for a given number of
+            threads.
+        */
+        MonteCarloModel(
+            const std::vector<std::shared_ptr<path_generator_type> >&
+                                                              pathGenerators,
+            const std::vector<std::shared_ptr<path_pricer_type> >& pathPricers,
+            const stats_type& sampleAccumulator,
+            bool antitheticVariate,
+            const std::vector<std::shared_ptr<path_pricer_type> >&
+                cvPathPricers = std::vector<std::shared_ptr<path_pricer_type> >(),
+            result_type cvOptionValue = result_type())
+        : pathGenerators_(pathGenerators), pathPricers_(pathPricers),
+          sampleAccumulator_(sampleAccumulator),
+          isAntitheticVariate_(antitheticVariate),
+          cvPathPricers_(cvPathPricers), cvOptionValue_(cvOptionValue) {
+            QL_REQUIRE(!pathGenerators_.empty(), "no path generator given");
+            QL_REQUIRE(pathPricers_.size() == pathGenerators_.size(),
+                       "mismatch between path generators ("
+                       << pathGenerators_.size() << ") and path pricers ("
+                       << pathPricers_.size() << ")");
+            isControlVariate_ = !cvPathPricers_.empty();
+            if (isControlVariate_)
+                QL_REQUIRE(cvPathPricers_.size() == pathGenerators_.size(),
+                           "mismatch between path generators ("
+                           << pathGenerators_.size()
+                           << ") and control-variate path pricers ("
+                           << cvPathPricers_.size() << ")");
+            else
+                cvPathPricers_.resize(pathGenerators_.size());
+            if (pathGenerators_.size() > 1)
+                pool_ = std::make_shared<ThreadPool>(pathGenerators_.size()-1);
+        }
         void addSamples(Size samples);
+        /*! Enables batch simulation: samples are drawn \p batchSize
+            at a time from the given generator (e.g., a
+            BatchPathGenerator) and valued by the path pricers, which
+            must implement the BatchPathPricer interface.  Samples are
+            added to the accumulator in the same order as in the
+            path-by-path simulation.
+
+            \warning only available for single-threaded models
+                     without a control-variate path generator.
+        */
+        template <class BatchGenerator>
+        void setBatchPathGenerator(
+                        const std::shared_ptr<BatchGenerator>& generator,
+                        Size batchSize);
         const stats_type& sampleAccumulator(void) const;
+        //! number of threads used for simulation
+        Size threads() const { return pathGenerators_.size(); }
+        //! number of samples drawn by the given thread for a batch
+        static Size threadSamples(Size samples, Size threads, Size thread) {
+            Size first = firstThreadSample(samples, threads, thread);
+            return std::min(samples, first + blockSize(samples, threads))
+                - std::min(samples, first);
+        }
+        //! index (within a batch) of the first sample drawn by a thread
+        static Size firstThreadSample(Size samples, Size threads,
+                                      Size thread) {
+            return thread * blockSize(samples, threads);
+        }
       private:
-        std::shared_ptr<path_generator_type> pathGenerator_;
-        std::shared_ptr<path_pricer_type> pathPricer_;
+        static Size blockSize(Size samples, Size threads) {
+            return (samples + threads - 1) / threads;
+        }
+        // stores the samples drawn by a worker thread until they can be
+        // added to the accumulator in a deterministic order
+        class SampleBuffer {
+          public:
+            void add(const result_type& value, Real weight) {
+                samples_.emplace_back(value, weight);
+            }
+            template <class Accumulator>
+            void flushTo(Accumulator& accumulator) {
+                for (const auto& s : samples_)
+                    accumulator.add(s.first, s.second);
+                samples_.clear();
+            }
+          private:
+            std::vector<std::pair<result_type, Real> > samples_;
+        };
+        template <class Accumulator>
+        void addSamples(Size thread, Size samples,
+                        Accumulator& accumulator);
+        std::vector<std::shared_ptr<path_generator_type> > pathGenerators_;
+        std::vector<std::shared_ptr<path_pricer_type> > pathPricers_;
         stats_type sampleAccumulator_;
         bool isAntitheticVariate_;
-        std::shared_ptr<path_pricer_type> cvPathPricer_;
+        std::vector<std::shared_ptr<path_pricer_type> > cvPathPricers_;
         result_type cvOptionValue_;
         bool isControlVariate_;
         std::shared_ptr<path_generator_type> cvPathGenerator_;
+        std::shared_ptr<ThreadPool> pool_;
+        std::function<void(Size)> batchSampler_;
     };
 
     // inline definitions
     template <template <class> class MC, class RNG, class S>
     inline void MonteCarloModel<MC,RNG,S>::addSamples(Size samples) {
+        if (batchSampler_) {
+            batchSampler_(samples);
+            return;
+        }
+
+        Size threads = pathGenerators_.size();
+        if (threads == 1) {
+            addSamples(0, samples, sampleAccumulator_);
+            return;
+        }
+
+        std::vector<SampleBuffer> buffers(threads);
+        pool_->parallelFor(threads, [&](Size i) {
+            addSamples(i, threadSamples(samples, threads, i), buffers[i]);
+        });
+        for (Size i=0; i<threads; ++i)
+            buffers[i].flushTo(sampleAccumulator_);
+    }
+
+    template <template <class> class MC, class RNG, class S>
+    template <class Accumulator>
+    inline void MonteCarloModel<MC,RNG,S>::addSamples(
+                                                Size thread, Size samples,
+                                                Accumulator& accumulator) {
+        path_generator_type& pathGenerator = *pathGenerators_[thread];
+        const path_pricer_type& pathPricer = *pathPricers_[thread];
+        const path_pricer_type* cvPathPricer = cvPathPricers_[thread].get();
+
         for(Size j = 1; j <= samples; j++) {
 
-            const sample_type& path = pathGenerator_->next();
-            result_type price = (*pathPricer_)(path.value);
+            const sample_type& path = pathGenerator.next();
+            result_type price = pathPricer(path.value);
 
             if (isControlVariate_) {
                 if (!cvPathGenerator_) {
-                    price += cvOptionValue_-(*cvPathPricer_)(path.value);
+                    price += cvOptionValue_-(*cvPathPricer)(path.value);
                 }
                 else {
                     const sample_type& cvPath = cvPathGenerator_->next();
-                    price += cvOptionValue_-(*cvPathPricer_)(cvPath.value);
+                    price += cvOptionValue_-(*cvPathPricer)(cvPath.value);
                 }
             }
 
             if (isAntitheticVariate_) {
-                const sample_type& atPath = pathGenerator_->antithetic();
-                result_type price2 = (*pathPricer_)(atPath.value);
+                const sample_type& atPath = pathGenerator.antithetic();
+                result_type price2 = pathPricer(atPath.value);
                 if (isControlVariate_) {
                     if (!cvPathGenerator_)
-                        price2 += cvOptionValue_-(*cvPathPricer_)(atPath.value);
+                        price2 += cvOptionValue_-(*cvPathPricer)(atPath.value);
                     else {
                         const sample_type& cvPath = cvPathGenerator_->antithetic();
-                        price2 += cvOptionValue_-(*cvPathPricer_)(cvPath.value);
+                        price2 += cvOptionValue_-(*cvPathPricer)(cvPath.value);
                     }
                 }
 
-                sampleAccumulator_.add((price+price2)/2.0, path.weight);
+                accumulator.add((price+price2)/2.0, path.weight);
             } else {
-                sampleAccumulator_.add(price, path.weight);
+                accumulator.add(price, path.weight);
             }
         }
     }
 
+    template <template <class> class MC, class RNG, class S>
+    template <class BatchGenerator>
+    inline void MonteCarloModel<MC,RNG,S>::setBatchPathGenerator(
+                        const std::shared_ptr<BatchGenerator>& generator,
+                        Size batchSize) {
+        QL_REQUIRE(generator, "null batch path generator");
+        QL_REQUIRE(batchSize > 0, "null batch size");
+        QL_REQUIRE(pathGenerators_.size() == 1,
+                   "batch simulation not available for "
+                   "multi-threaded models");
+        QL_REQUIRE(!cvPathGenerator_,
+                   "control-variate path generator not supported "
+                   "in batch simulations");
+        const BatchPathPricer* pricer =
+            dynamic_cast<const BatchPathPricer*>(pathPricers_[0].get());
+        QL_REQUIRE(pricer, "path pricer does not support batches");
+        const BatchPathPricer* cvPricer = nullptr;
+        if (isControlVariate_) {
+            cvPricer =
+                dynamic_cast<const BatchPathPricer*>(cvPathPricers_[0].get());
+            QL_REQUIRE(cvPricer,
+                       "control-variate path pricer does not support "
+                       "batches");
+        }
+
+        std::vector<Real> prices(batchSize), controls;
+        if (isControlVariate_)
+            controls.resize(batchSize);
+        std::vector<Real> atPrices(isAntitheticVariate_ ? batchSize : 0);
+
+        batchSampler_ = [this, generator, pricer, cvPricer, batchSize,
+                         prices, atPrices, controls](Size samples) mutable {
+            while (samples > 0) {
+                Size n = std::min(samples, batchSize);
+                const PathBatch& paths = generator->next(n);
+                (*pricer)(paths, prices.data());
+                if (cvPricer) {
+                    (*cvPricer)(paths, controls.data());
+                    for (Size j=0; j<n; ++j)
+                        prices[j] += cvOptionValue_-controls[j];
+                }
+
+                if (isAntitheticVariate_) {
+                    const PathBatch& atPaths = generator->antithetic();
+                    (*pricer)(atPaths, atPrices.data());
+                    if (cvPricer) {
+                        (*cvPricer)(atPaths, controls.data());
+                        for (Size j=0; j<n; ++j)
+                            atPrices[j] += cvOptionValue_-controls[j];
+                    }
+                    for (Size j=0; j<n; ++j)
+                        sampleAccumulator_.add((prices[j]+atPrices[j])/2.0,
+                                               paths.weight(j));
+                } else {
+                    for (Size j=0; j<n; ++j)
+                        sampleAccumulator_.add(prices[j], paths.weight(j));
+                }
+                samples -= n;
+            }
+        };
+    }
+
     template <template <class> class MC, class RNG, class S>
     inline const typename MonteCarloModel<MC,RNG,S>::stats_type&
     MonteCarloModel<MC,RNG,S>::sampleAccumulator() const {
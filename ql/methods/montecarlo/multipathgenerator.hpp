@@ -28,6 +28,7 @@
 #define quantlib_multi_path_generator_hpp
 
 #include <ql/methods/montecarlo/multipath.hpp>
+#include <ql/methods/montecarlo/pathpool.hpp>
 #include <ql/methods/montecarlo/sample.hpp>
 #include <ql/stochasticprocess.hpp>
 
@@ -56,8 +57,20 @@ namespace QuantLib {
                            bool brownianBridge = false);
         const sample_type& next() const;
         const sample_type& antithetic() const;
+        //! \name generation into external storage
+        /*! These draw the same paths as next() and antithetic(),
+            but write them into the given view (e.g., a slot of a
+            PathPool) instead of the internal sample; the weight of
+            the sample is returned.
+        */
+        //@{
+        Real next(MultiPathView path) const;
+        Real antithetic(MultiPathView path) const;
+        //@}
       private:
         const sample_type& next(bool antithetic) const;
+        template <class P>
+        Real generate(P& path, bool antithetic) const;
         bool brownianBridge_;
         std::shared_ptr<StochasticProcess> process_;
         GSG generator_;
@@ -99,9 +112,33 @@ namespace QuantLib {
         return next(true);
     }
 
+    template <class GSG>
+    Real MultiPathGenerator<GSG>::next(MultiPathView path) const {
+        QL_REQUIRE(path.assetNumber() == next_.value.assetNumber() &&
+                   path.pathSize() == next_.value.pathSize(),
+                   "path size mismatch");
+        return generate(path, false);
+    }
+
+    template <class GSG>
+    Real MultiPathGenerator<GSG>::antithetic(MultiPathView path) const {
+        QL_REQUIRE(path.assetNumber() == next_.value.assetNumber() &&
+                   path.pathSize() == next_.value.pathSize(),
+                   "path size mismatch");
+        return generate(path, true);
+    }
+
     template <class GSG>
     const typename MultiPathGenerator<GSG>::sample_type&
     MultiPathGenerator<GSG>::next(bool antithetic) const {
+        next_.weight = generate(next_.value, antithetic);
+        return next_;
+    }
+
+    template <class GSG>
+    template <class P>
+    Real MultiPathGenerator<GSG>::generate(P& path,
+                                           bool antithetic) const {
 
         if (brownianBridge_) {
 
@@ -117,14 +154,11 @@ namespace QuantLib {
             Size m = process_->size();
             Size n = process_->factors();
 
-            MultiPath& path = next_.value;
-
             Array asset = process_->initialValues();
             for (Size j=0; j<m; j++)
                 path[j].front() = asset[j];
 
             Array temp(n);
-            next_.weight = sequence_.weight;
 
             const TimeGrid& timeGrid = path[0].timeGrid();
             Time t, dt;
@@ -146,7 +180,7 @@ namespace QuantLib {
                 for (Size j=0; j<m; j++)
                     path[j][i] = asset[j];
             }
-            return next_;
+            return sequence_.weight;
         }
     }
 
@@ -0,0 +1,110 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file pathbatch.hpp
+    \brief batch of single-factor random paths
+*/
+
+#ifndef quantlib_montecarlo_path_batch_hpp
+#define quantlib_montecarlo_path_batch_hpp
+
+#include <ql/methods/montecarlo/path.hpp>
+#include <vector>
+
+namespace QuantLib {
+
+    //! batch of single-factor random paths on a common time grid
+    /*! The values are stored by time node, i.e., the values of all
+        paths at a given node are contiguous in memory; this allows
+        path generators and pricers to work on all paths at once
+        with tight loops over the paths.
+
+        \ingroup mcarlo
+    */
+    class PathBatch {
+      public:
+        explicit PathBatch(TimeGrid timeGrid, Size paths = 0)
+        : timeGrid_(std::move(timeGrid)), paths_(paths),
+          values_(timeGrid_.size()*paths), weights_(paths, 1.0) {}
+        //! \name inspectors
+        //@{
+        //! number of paths in the batch
+        Size size() const { return paths_; }
+        //! number of time nodes in each path
+        Size length() const { return timeGrid_.size(); }
+        const TimeGrid& timeGrid() const { return timeGrid_; }
+        //! value of the given path at the given time node
+        Real operator()(Size node, Size path) const {
+            return values_[node*paths_ + path];
+        }
+        //! values of all paths at the given time node
+        const Real* values(Size node) const {
+            return values_.data() + node*paths_;
+        }
+        Real weight(Size path) const { return weights_[path]; }
+        //! copy of a single path of the batch
+        Path path(Size path) const {
+            Array values(length());
+            for (Size i=0; i<values.size(); ++i)
+                values[i] = (*this)(i, path);
+            return Path(timeGrid_, values);
+        }
+        //@}
+        //! \name modifiers
+        //@{
+        Real& operator()(Size node, Size path) {
+            return values_[node*paths_ + path];
+        }
+        Real* values(Size node) {
+            return values_.data() + node*paths_;
+        }
+        Real& weight(Size path) { return weights_[path]; }
+        //! changes the number of paths; values are not preserved
+        void resize(Size paths) {
+            paths_ = paths;
+            values_.resize(timeGrid_.size()*paths);
+            weights_.resize(paths);
+        }
+        //@}
+      private:
+        TimeGrid timeGrid_;
+        Size paths_;
+        std::vector<Real> values_;
+        std::vector<Real> weights_;
+    };
+
+
+    //! base class for path pricers working on batches of paths
+    /*! Path pricers can implement this interface besides PathPricer
+        in order to be used with a BatchPathGenerator.  The value of
+        each path must be the one that the single-path pricer would
+        return for the same path.
+
+        \ingroup mcarlo
+    */
+    class BatchPathPricer {
+      public:
+        virtual ~BatchPathPricer() = default;
+        //! writes the value of each path of the batch into \p values
+        virtual void operator()(const PathBatch& paths,
+                                Real* values) const = 0;
+    };
+
+}
+
+
+#endif
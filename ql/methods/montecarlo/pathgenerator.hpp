@@ -27,6 +27,7 @@
 #define quantlib_montecarlo_path_generator_hpp
 
 #include <ql/methods/montecarlo/brownianbridge.hpp>
+#include <ql/methods/montecarlo/pathpool.hpp>
 #include <ql/stochasticprocess.hpp>
 
 namespace QuantLib {
@@ -61,8 +62,20 @@ namespace QuantLib {
         Size size() const { return dimension_; }
         const TimeGrid& timeGrid() const { return timeGrid_; }
         //@}
+        //! \name generation into external storage
+        /*! These draw the same paths as next() and antithetic(),
+            but write them into the given view (e.g., a slot of a
+            PathPool) instead of the internal sample; the weight of
+            the sample is returned.
+        */
+        //@{
+        Real next(PathView path) const;
+        Real antithetic(PathView path) const;
+        //@}
       private:
         const sample_type& next(bool antithetic) const;
+        template <class P>
+        Real generate(P& path, bool antithetic) const;
         bool brownianBridge_;
         GSG generator_;
         Size dimension_;
@@ -119,9 +132,32 @@ namespace QuantLib {
         return next(true);
     }
 
+    template <class GSG>
+    Real PathGenerator<GSG>::next(PathView path) const {
+        QL_REQUIRE(path.length() == timeGrid_.size(),
+                   "path size (" << path.length()
+                   << ") != time-grid size (" << timeGrid_.size() << ")");
+        return generate(path, false);
+    }
+
+    template <class GSG>
+    Real PathGenerator<GSG>::antithetic(PathView path) const {
+        QL_REQUIRE(path.length() == timeGrid_.size(),
+                   "path size (" << path.length()
+                   << ") != time-grid size (" << timeGrid_.size() << ")");
+        return generate(path, true);
+    }
+
     template <class GSG>
     const typename PathGenerator<GSG>::sample_type&
     PathGenerator<GSG>::next(bool antithetic) const {
+        next_.weight = generate(next_.value, antithetic);
+        return next_;
+    }
+
+    template <class GSG>
+    template <class P>
+    Real PathGenerator<GSG>::generate(P& path, bool antithetic) const {
 
         typedef typename GSG::sample_type sequence_type;
         const sequence_type& sequence_ =
@@ -138,9 +174,6 @@ namespace QuantLib {
                       temp_.begin());
         }
 
-        next_.weight = sequence_.weight;
-
-        Path& path = next_.value;
         path.front() = process_->x0();
 
         for (Size i=1; i<path.length(); i++) {
@@ -151,7 +184,7 @@ namespace QuantLib {
                                                      temp_[i-1]);
         }
 
-        return next_;
+        return sequence_.weight;
     }
 
 }
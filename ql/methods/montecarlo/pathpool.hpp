@@ -0,0 +1,284 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file pathpool.hpp
+    \brief pooled storage of random paths
+*/
+
+#ifndef quantlib_montecarlo_path_pool_hpp
+#define quantlib_montecarlo_path_pool_hpp
+
+#include <ql/methods/montecarlo/multipath.hpp>
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace QuantLib {
+
+    //! non-owning view of a single-factor path
+    /*! The view provides the interface of Path on values stored
+        elsewhere, e.g., in a PathPool; it is only valid as long as
+        the underlying storage and time grid are.
+
+        \ingroup mcarlo
+    */
+    class PathView {
+      public:
+        PathView(const TimeGrid& timeGrid, Real* values)
+        : timeGrid_(&timeGrid), values_(values) {}
+        //! \name inspectors
+        //@{
+        bool empty() const { return timeGrid_->empty(); }
+        Size length() const { return timeGrid_->size(); }
+        //! asset value at the \f$ i \f$-th point
+        Real operator[](Size i) const { return values_[i]; }
+        Real at(Size i) const;
+        Real& operator[](Size i) { return values_[i]; }
+        Real& at(Size i);
+        Real value(Size i) const { return values_[i]; }
+        Real& value(Size i) { return values_[i]; }
+        //! time at the \f$ i \f$-th point
+        Time time(Size i) const { return (*timeGrid_)[i]; }
+        //! initial asset value
+        Real front() const { return values_[0]; }
+        Real& front() { return values_[0]; }
+        //! final asset value
+        Real back() const { return values_[length()-1]; }
+        Real& back() { return values_[length()-1]; }
+        //! time grid
+        const TimeGrid& timeGrid() const { return *timeGrid_; }
+        //@}
+        //! \name iterators
+        //@{
+        typedef const Real* iterator;
+        typedef std::reverse_iterator<iterator> reverse_iterator;
+        iterator begin() const { return values_; }
+        iterator end() const { return values_ + length(); }
+        reverse_iterator rbegin() const { return reverse_iterator(end()); }
+        reverse_iterator rend() const { return reverse_iterator(begin()); }
+        //@}
+      private:
+        const TimeGrid* timeGrid_;
+        Real* values_;
+    };
+
+
+    //! non-owning view of correlated multiple asset paths
+    /*! The paths of the assets are stored one after the other;
+        view[j] is the path followed by the j-th asset.
+
+        \ingroup mcarlo
+    */
+    class MultiPathView {
+      public:
+        MultiPathView(const TimeGrid& timeGrid, Real* values, Size nAsset)
+        : timeGrid_(&timeGrid), values_(values), nAsset_(nAsset) {}
+        //! \name inspectors
+        //@{
+        Size assetNumber() const { return nAsset_; }
+        Size pathSize() const { return timeGrid_->size(); }
+        //@}
+        //! \name read/write access to components
+        //@{
+        const PathView operator[](Size j) const {
+            return PathView(*timeGrid_, values_ + j*pathSize());
+        }
+        const PathView at(Size j) const;
+        PathView operator[](Size j) {
+            return PathView(*timeGrid_, values_ + j*pathSize());
+        }
+        PathView at(Size j);
+        //@}
+      private:
+        const TimeGrid* timeGrid_;
+        Real* values_;
+        Size nAsset_;
+    };
+
+
+    //! pooled storage of random paths
+    /*! The paths in the pool share a single time grid, and their
+        values are stored one path after the other in a single
+        buffer; storing a path thus requires no allocation once the
+        buffer has grown to its final size, and clearing the pool
+        keeps the buffer for reuse.  The paths are accessed through
+        views which path generators can fill directly (see, e.g.,
+        PathGenerator::next(PathView) and
+        MultiPathGenerator::next(MultiPathView)).
+
+        A default-constructed pool takes its time grid and number of
+        assets from the first path added to it; paths copied into the
+        pool later must have the same number of assets and the same
+        time grid, including after the pool is cleared.
+
+        \warning views are invalidated when paths are added to the
+                 pool, as the buffer might be reallocated.
+
+        \ingroup mcarlo
+    */
+    class PathPool {
+      public:
+        PathPool() = default;
+        explicit PathPool(TimeGrid timeGrid, Size nAsset = 1);
+        //! \name inspectors
+        //@{
+        //! number of paths in the pool
+        Size size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+        Size assetNumber() const { return nAsset_; }
+        Size pathSize() const { return timeGrid_.size(); }
+        const TimeGrid& timeGrid() const { return timeGrid_; }
+        //@}
+        //! \name access to the paths
+        //@{
+        const MultiPathView operator[](Size i) const {
+            return MultiPathView(timeGrid_,
+                                 const_cast<Real*>(values_.data()) + i*slot(),
+                                 nAsset_);
+        }
+        MultiPathView operator[](Size i) {
+            return MultiPathView(timeGrid_, values_.data() + i*slot(),
+                                 nAsset_);
+        }
+        //! copies the \f$ i \f$-th path into a path on the same grid
+        void copy(Size i, Path& path) const;
+        void copy(Size i, MultiPath& path) const;
+        //@}
+        //! \name modifiers
+        //@{
+        //! adds a path and returns a view to be filled with its values
+        MultiPathView add();
+        //! adds a copy of the given path
+        void add(const Path& path);
+        void add(const MultiPath& path);
+        //! makes room for the given number of paths
+        void reserve(Size paths) { values_.reserve(paths*slot()); }
+        //! removes all paths, keeping the memory for reuse
+        void clear() { size_ = 0; }
+        //! removes all paths and releases the memory
+        void release();
+        //@}
+      private:
+        Size slot() const { return nAsset_*timeGrid_.size(); }
+        void shape(const TimeGrid& timeGrid, Size nAsset);
+        TimeGrid timeGrid_;
+        Size nAsset_ = 0, size_ = 0;
+        std::vector<Real> values_;
+    };
+
+
+    // inline definitions
+
+    inline Real PathView::at(Size i) const {
+        QL_REQUIRE(i < length(), "index (" << i << ") must be less than "
+                   << length() << ": path access out of range");
+        return values_[i];
+    }
+
+    inline Real& PathView::at(Size i) {
+        QL_REQUIRE(i < length(), "index (" << i << ") must be less than "
+                   << length() << ": path access out of range");
+        return values_[i];
+    }
+
+    inline const PathView MultiPathView::at(Size j) const {
+        QL_REQUIRE(j < nAsset_, "index (" << j << ") must be less than "
+                   << nAsset_ << ": asset access out of range");
+        return (*this)[j];
+    }
+
+    inline PathView MultiPathView::at(Size j) {
+        QL_REQUIRE(j < nAsset_, "index (" << j << ") must be less than "
+                   << nAsset_ << ": asset access out of range");
+        return (*this)[j];
+    }
+
+    inline PathPool::PathPool(TimeGrid timeGrid, Size nAsset)
+    : timeGrid_(std::move(timeGrid)), nAsset_(nAsset) {
+        QL_REQUIRE(nAsset > 0, "number of asset must be positive");
+        QL_REQUIRE(!timeGrid_.empty(), "empty time grid");
+    }
+
+    inline void PathPool::shape(const TimeGrid& timeGrid, Size nAsset) {
+        if (nAsset_ == 0) {
+            timeGrid_ = timeGrid;
+            nAsset_ = nAsset;
+        }
+        QL_REQUIRE(nAsset == nAsset_,
+                   "path with " << nAsset << " assets added to a pool of "
+                   "paths with " << nAsset_);
+        QL_REQUIRE(timeGrid.size() == timeGrid_.size(),
+                   "path with " << timeGrid.size() << " points added to "
+                   "a pool of paths with " << timeGrid_.size());
+        QL_REQUIRE(std::equal(timeGrid.begin(), timeGrid.end(),
+                              timeGrid_.begin()),
+                   "path on a different time grid added to a pool of paths");
+    }
+
+    inline MultiPathView PathPool::add() {
+        QL_REQUIRE(nAsset_ > 0, "pool not initialized");
+        Size n = slot();
+        if (values_.size() < (size_+1)*n)
+            values_.resize((size_+1)*n);
+        return MultiPathView(timeGrid_, values_.data() + (size_++)*n,
+                             nAsset_);
+    }
+
+    inline void PathPool::add(const Path& path) {
+        shape(path.timeGrid(), 1);
+        PathView view = add()[0];
+        for (Size k=0; k<path.length(); ++k)
+            view[k] = path[k];
+    }
+
+    inline void PathPool::add(const MultiPath& path) {
+        shape(path[0].timeGrid(), path.assetNumber());
+        MultiPathView view = add();
+        for (Size j=0; j<nAsset_; ++j) {
+            PathView asset = view[j];
+            for (Size k=0; k<asset.length(); ++k)
+                asset[k] = path[j][k];
+        }
+    }
+
+    inline void PathPool::copy(Size i, Path& path) const {
+        QL_REQUIRE(path.length() == pathSize(), "path size mismatch");
+        const PathView view = (*this)[i][0];
+        for (Size k=0; k<view.length(); ++k)
+            path[k] = view[k];
+    }
+
+    inline void PathPool::copy(Size i, MultiPath& path) const {
+        QL_REQUIRE(path.assetNumber() == nAsset_ &&
+                   path.pathSize() == pathSize(), "path size mismatch");
+        const MultiPathView view = (*this)[i];
+        for (Size j=0; j<nAsset_; ++j) {
+            const PathView asset = view[j];
+            for (Size k=0; k<asset.length(); ++k)
+                path[j][k] = asset[k];
+        }
+    }
+
+    inline void PathPool::release() {
+        size_ = 0;
+        std::vector<Real>().swap(values_);
+    }
+
+}
+
+
+#endif
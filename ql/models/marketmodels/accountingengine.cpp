@@ -22,6 +22,8 @@
 #include <ql/models/marketmodels/evolver.hpp>
 #include <ql/models/marketmodels/evolutiondescription.hpp>
 #include <ql/models/marketmodels/curvestate.hpp>
+#include <ql/models/marketmodels/browniangenerator.hpp>
+#include <ql/utilities/threadpool.hpp>
 #include <algorithm>
 
 namespace QuantLib {
@@ -50,6 +52,23 @@ namespace QuantLib {
 
     }
 
+    AccountingEngine::AccountingEngine(
+               EvolverFactory evolverFactory,
+               std::shared_ptr<BrownianGeneratorFactory> generatorFactory,
+               const Clone<MarketModelMultiProduct>& product,
+               Real initialNumeraireValue,
+               Size threads)
+    : product_(product), initialNumeraireValue_(initialNumeraireValue),
+      numberProducts_(product->numberOfProducts()),
+      evolverFactory_(std::move(evolverFactory)),
+      generatorFactory_(std::move(generatorFactory)), threads_(threads) {
+        QL_REQUIRE(evolverFactory_, "no evolver factory given");
+        QL_REQUIRE(generatorFactory_, "no generator factory given");
+        QL_REQUIRE(threads_ > 0, "at least one thread required");
+        if (threads_ > 1)
+            pool_ = std::make_shared<ThreadPool>(threads_-1);
+    }
+
     Real AccountingEngine::singlePathValues(std::vector<Real>& values) {
         std::fill(numerairesHeld_.begin(), numerairesHeld_.end(), 0.0);
         Real weight = evolver_->startNewPath();
@@ -115,6 +134,10 @@ namespace QuantLib {
     void AccountingEngine::multiplePathValues(SequenceStatisticsInc& stats,
                                               Size numberOfPaths)
     {
+        if (evolverFactory_) {
+            multiThreadedPathValues(stats, numberOfPaths);
+            return;
+        }
         std::vector<Real> values(product_->numberOfProducts());
         for (Size i=0; i<numberOfPaths; ++i) {
             Real weight = singlePathValues(values);
@@ -122,4 +145,44 @@ namespace QuantLib {
         }
     }
 
+    void AccountingEngine::multiThreadedPathValues(
+                                               SequenceStatisticsInc& stats,
+                                               Size numberOfPaths) {
+        Size blockSize = (numberOfPaths + threads_ - 1) / threads_;
+        std::vector<Size> firstPaths(threads_), paths(threads_);
+        std::vector<std::unique_ptr<AccountingEngine> > engines(threads_);
+        for (Size i=0; i<threads_; ++i) {
+            firstPaths[i] = std::min(numberOfPaths, i*blockSize);
+            paths[i] = std::min(numberOfPaths, firstPaths[i] + blockSize)
+                - firstPaths[i];
+            StreamBrownianGeneratorFactory factory(
+                                  generatorFactory_, streamsUsed_ + i,
+                                  pathsDrawn_ + firstPaths[i]);
+            engines[i] = std::make_unique<AccountingEngine>(
+                              evolverFactory_(factory), product_,
+                              initialNumeraireValue_);
+        }
+
+        // each thread collects the values of its paths; the results
+        // are merged in path order
+        std::vector<SequenceStatisticsInc> threadStats(
+                        threads_, SequenceStatisticsInc(numberProducts_));
+        auto simulate = [&](Size i) {
+            std::vector<Real> values(numberProducts_);
+            for (Size j=0; j<paths[i]; ++j) {
+                Real weight = engines[i]->singlePathValues(values);
+                threadStats[i].add(values, weight);
+            }
+        };
+        if (pool_)
+            pool_->parallelFor(threads_, simulate);
+        else
+            simulate(0);
+
+        for (Size i=0; i<threads_; ++i)
+            stats.merge(threadStats[i]);
+        streamsUsed_ += threads_;
+        pathsDrawn_ += numberOfPaths;
+    }
+
 }
@@ -29,11 +29,14 @@
 
 #include <ql/utilities/clone.hpp>
 #include <ql/types.hpp>
+#include <functional>
 #include <vector>
 
 namespace QuantLib {
 
     class MarketModelEvolver;
+    class BrownianGeneratorFactory;
+    class ThreadPool;
 
     //class MarketModelDiscounter;
     //class SequenceStatistics;
@@ -43,13 +46,48 @@ namespace QuantLib {
     //! Engine collecting cash flows along a market-model simulation
     class AccountingEngine {
       public:
+        //! builds an evolver drawing from the given generator factory
+        typedef std::function<std::shared_ptr<MarketModelEvolver>(
+                                const BrownianGeneratorFactory&)>
+            EvolverFactory;
+
         AccountingEngine(const std::shared_ptr<MarketModelEvolver>& evolver,
                          const Clone<MarketModelMultiProduct>& product,
                          Real initialNumeraireValue);
+        //! multi-threaded engine
+        /*! The paths requested by each call to multiplePathValues()
+            are split among threads in contiguous blocks.  Each thread
+            simulates its block with its own copy of the product and
+            its own evolver, built by \p evolverFactory from a factory
+            returning the generators of \p generatorFactory for one of
+            its streams (see BrownianGeneratorFactory::createStream);
+            the generators used by different calls draw from different
+            streams.
+
+            Each thread collects the values of its paths in its own
+            statistics, which are then merged in path order; results
+            are therefore reproducible for a given number of threads.
+            They don't depend on the number of threads (up to rounding
+            in the covariance) only if the generators of the factory
+            draw a single sequence, skipping to the first path of each
+            block, as the Sobol generators do.
+
+            \warning evolvers are built on the calling thread, but the
+                     generators, evolvers and products must not share
+                     state without synchronization.
+        */
+        AccountingEngine(EvolverFactory evolverFactory,
+                         std::shared_ptr<BrownianGeneratorFactory>
+                                                           generatorFactory,
+                         const Clone<MarketModelMultiProduct>& product,
+                         Real initialNumeraireValue,
+                         Size threads);
         void multiplePathValues(SequenceStatisticsInc& stats,
                                 Size numberOfPaths);
       private:
         Real singlePathValues(std::vector<Real>& values);
+        void multiThreadedPathValues(SequenceStatisticsInc& stats,
+                                     Size numberOfPaths);
 
         std::shared_ptr<MarketModelEvolver> evolver_;
         Clone<MarketModelMultiProduct> product_;
@@ -57,6 +95,13 @@ namespace QuantLib {
         Real initialNumeraireValue_;
         Size numberProducts_;
 
+        // multi-threaded simulation
+        EvolverFactory evolverFactory_;
+        std::shared_ptr<BrownianGeneratorFactory> generatorFactory_;
+        Size threads_ = 1;
+        std::shared_ptr<ThreadPool> pool_;
+        Size streamsUsed_ = 0, pathsDrawn_ = 0;
+
         // workspace
         std::vector<Real> numerairesHeld_;
         std::vector<Size> numberCashFlowsThisStep_;
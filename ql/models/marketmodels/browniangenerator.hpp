@@ -21,9 +21,11 @@
 #ifndef quantlib_brownian_generator_hpp
 #define quantlib_brownian_generator_hpp
 
+#include <ql/errors.hpp>
 #include <ql/types.hpp>
 #include <memory>
 #include <algorithm>
+#include <utility>
 #include <vector>
 
 namespace QuantLib {
@@ -52,6 +54,43 @@ namespace QuantLib {
 
         virtual std::shared_ptr<BrownianGenerator> create(Size factors,
                                                             Size steps) const = 0;
+        //! generator for one of a set of streams
+        /*! Used for multi-threaded simulations; the generator must
+            draw from the given stream, independent of the others,
+            and the first path it draws has index \p firstPath in the
+            simulation.  Pseudo-random generators usually use the
+            stream and ignore the first path; low-discrepancy ones
+            draw a single sequence and skip to the first path.
+        */
+        virtual std::shared_ptr<BrownianGenerator>
+        createStream(Size factors,
+                     Size steps,
+                     Size stream,
+                     Size firstPath) const {
+            QL_FAIL("streams not supported by Brownian generator factory");
+        }
+    };
+
+    //! factory returning the generators of a stream of another factory
+    /*! Used to build the evolvers of multi-threaded simulations, see
+        BrownianGeneratorFactory::createStream.
+    */
+    class StreamBrownianGeneratorFactory : public BrownianGeneratorFactory {
+      public:
+        StreamBrownianGeneratorFactory(
+                         std::shared_ptr<BrownianGeneratorFactory> factory,
+                         Size stream,
+                         Size firstPath)
+        : factory_(std::move(factory)), stream_(stream),
+          firstPath_(firstPath) {}
+        std::shared_ptr<BrownianGenerator> create(Size factors,
+                                                  Size steps) const {
+            return factory_->createStream(factors, steps,
+                                          stream_, firstPath_);
+        }
+      private:
+        std::shared_ptr<BrownianGeneratorFactory> factory_;
+        Size stream_, firstPath_;
     };
 
 }
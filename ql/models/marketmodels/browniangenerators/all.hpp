@@ -3,4 +3,5 @@
 
 #include <ql/models/marketmodels/browniangenerators/mtbrowniangenerator.hpp>
 #include <ql/models/marketmodels/browniangenerators/sobolbrowniangenerator.hpp>
+#include <ql/models/marketmodels/browniangenerators/zigguratbrowniangenerator.hpp>
 
@@ -18,6 +18,7 @@
 */
 
 #include <ql/models/marketmodels/browniangenerators/mtbrowniangenerator.hpp>
+#include <ql/math/randomnumbers/rngtraits.hpp>
 
 namespace QuantLib {
 
@@ -65,5 +66,14 @@ namespace QuantLib {
         return std::make_shared<MTBrownianGenerator>(factors, steps, seed_);
     }
 
+    std::shared_ptr<BrownianGenerator>
+    MTBrownianGeneratorFactory::createStream(Size factors,
+                                             Size steps,
+                                             Size stream,
+                                             Size) const {
+        return std::make_shared<MTBrownianGenerator>(
+                    factors, steps, detail::streamSeed(seed_, stream));
+    }
+
 }
 
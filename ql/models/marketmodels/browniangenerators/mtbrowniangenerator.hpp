@@ -63,6 +63,15 @@ namespace QuantLib {
         MTBrownianGeneratorFactory(unsigned long seed = 0);
         std::shared_ptr<BrownianGenerator> create(Size factors,
                                                     Size steps) const;
+        /*! The seed of each stream is drawn from a Mersenne-Twister
+            generator initialized with the given seed, as in
+            GenericPseudoRandom; the index of the first path is not
+            used.
+        */
+        std::shared_ptr<BrownianGenerator> createStream(Size factors,
+                                                        Size steps,
+                                                        Size stream,
+                                                        Size firstPath) const;
       private:
         unsigned long seed_;
     };
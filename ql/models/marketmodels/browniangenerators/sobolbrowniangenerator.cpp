@@ -18,7 +18,6 @@
 */
 
 #include <ql/models/marketmodels/browniangenerators/sobolbrowniangenerator.hpp>
-#include <ql/utilities/transformiterator.hpp>
 
 namespace QuantLib {
 
@@ -71,6 +70,16 @@ namespace QuantLib {
             }
         }
 
+        SobolRsg sobolFromPath(Size dimensionality,
+                               unsigned long seed,
+                               SobolRsg::DirectionIntegers integers,
+                               Size firstPath) {
+            SobolRsg rsg(dimensionality, seed, integers);
+            if (firstPath > 0)
+                rsg.skipTo(firstPath);
+            return rsg;
+        }
+
         /*
         // variate 2 is used for the first factor's half path
         void fillByDiagonal(std::vector<std::vector<Size> >& M,
@@ -112,13 +121,18 @@ namespace QuantLib {
                                         Size steps,
                                         Ordering ordering,
                                         unsigned long seed,
-                                        SobolRsg::DirectionIntegers integers)
+                                        SobolRsg::DirectionIntegers integers,
+                                        Size batchSize,
+                                        Size firstPath)
     : factors_(factors), steps_(steps), ordering_(ordering),
-      generator_(SobolRsg(factors*steps, seed, integers),
+      generator_(sobolFromPath(factors*steps, seed, integers, firstPath),
                  InverseCumulativeNormal()),
-      bridge_(steps), lastStep_(0),
+      bridge_(steps), batchSize_(batchSize), lastStep_(0),
+      currentPath_(batchSize),
       orderedIndices_(factors, std::vector<Size>(steps)),
-      bridgedVariates_(factors, std::vector<Real>(steps)) {
+      samples_(factors*steps*batchSize), variates_(factors*steps*batchSize),
+      bridgedVariates_(factors*steps*batchSize), weights_(batchSize) {
+        QL_REQUIRE(batchSize_ > 0, "null batch size");
 
         switch (ordering_) {
           case Factors:
@@ -137,23 +151,35 @@ namespace QuantLib {
 
 
     Real SobolBrownianGenerator::nextPath() {
-        typedef InverseCumulativeRsg<SobolRsg,
-                                     InverseCumulativeNormal>::sample_type
-            sample_type;
-
-        const sample_type& sample = generator_.nextSequence();
-        // Brownian-bridge the variates according to the ordered indices
-        for (Size i=0; i<factors_; ++i) {
-            bridge_.transform(permutationIterator<std::vector<Real>::const_iterator, std::vector<Size>::iterator>(
-                                                  sample.value.begin(),
-                                                  orderedIndices_[i].begin()),
-                              permutationIterator<std::vector<Real>::const_iterator, std::vector<Size>::iterator>(
-                                                  sample.value.begin(),
-                                                  orderedIndices_[i].end()),
-                              bridgedVariates_[i].begin());
+        if (++currentPath_ >= batchSize_) {
+            nextBatch();
+            currentPath_ = 0;
         }
         lastStep_ = 0;
-        return sample.weight;
+        return weights_[currentPath_];
+    }
+
+    void SobolBrownianGenerator::nextBatch() {
+        // draw the Sobol points for the whole batch at once...
+        generator_.nextBlock(batchSize_, samples_.data());
+        std::fill(weights_.begin(), weights_.end(), 1.0);
+
+        // ...gather the variates of each factor according to the
+        // ordered indices...
+        const Size dimension = factors_*steps_;
+        for (Size p=0; p<batchSize_; ++p) {
+            const Real* sample = &samples_[p*dimension];
+            for (Size i=0; i<factors_; ++i) {
+                Real* variates = &variates_[i*steps_*batchSize_] + p;
+                for (Size j=0; j<steps_; ++j)
+                    variates[j*batchSize_] = sample[orderedIndices_[i][j]];
+            }
+        }
+        // ...and Brownian-bridge them for all paths at once
+        for (Size i=0; i<factors_; ++i)
+            bridge_.transformBatch(&variates_[i*steps_*batchSize_],
+                                   &bridgedVariates_[i*steps_*batchSize_],
+                                   batchSize_);
     }
     
     
@@ -168,26 +194,24 @@ namespace QuantLib {
         QL_REQUIRE(   (variates.size() == factors_*steps_),
                    "inconsistent variate vector");
 
-        const Size dim    = factors_*steps_;
         const Size nPaths = variates.front().size();
         
         std::vector<std::vector<Real> > 
                        retVal(factors_, std::vector<Real>(nPaths*steps_));
-        
-        for (Size j=0; j < nPaths; ++j) {
-            std::vector<Real> sample(steps_*factors_);
-            for (Size k=0; k < dim; ++k) {
-                sample[k] = variates[k][j];
-            }
-            for (Size i=0; i<factors_; ++i) {
-                bridge_.transform(permutationIterator<std::vector<Real>::iterator, std::vector<Size>::iterator>(
-                                                  sample.begin(),
-                                                  orderedIndices_[i].begin()),
-                          permutationIterator<std::vector<Real>::iterator, std::vector<Size>::iterator>(
-                                                  sample.begin(),
-                                                  orderedIndices_[i].end()),
-                          retVal[i].begin()+j*steps_);
+
+        // the variates are already stored by variate, as required
+        // by the batch transform; only the output is rearranged
+        std::vector<Real> input(steps_*nPaths), output(steps_*nPaths);
+        for (Size i=0; i<factors_; ++i) {
+            for (Size k=0; k < steps_; ++k) {
+                const std::vector<Real>& v = variates[orderedIndices_[i][k]];
+                QL_REQUIRE(v.size() == nPaths, "inconsistent variate vector");
+                std::copy(v.begin(), v.end(), input.begin() + k*nPaths);
             }
+            bridge_.transformBatch(input.data(), output.data(), nPaths);
+            for (Size j=0; j < nPaths; ++j)
+                for (Size k=0; k < steps_; ++k)
+                    retVal[i][j*steps_+k] = output[k*nPaths+j];
         }
         
         return retVal;
@@ -198,8 +222,10 @@ namespace QuantLib {
         QL_REQUIRE(output.size() == factors_, "size mismatch");
         QL_REQUIRE(lastStep_<steps_, "sequence exhausted");
         #endif
+        const Real* variates =
+            &bridgedVariates_[lastStep_*batchSize_ + currentPath_];
         for (Size i=0; i<factors_; ++i)
-            output[i] = bridgedVariates_[i][lastStep_];
+            output[i] = variates[i*steps_*batchSize_];
         ++lastStep_;
         return 1.0;
     }
@@ -213,13 +239,26 @@ namespace QuantLib {
     SobolBrownianGeneratorFactory::SobolBrownianGeneratorFactory(
                                     SobolBrownianGenerator::Ordering ordering,
                                     unsigned long seed,
-                                    SobolRsg::DirectionIntegers integers)
-    : ordering_(ordering), seed_(seed), integers_(integers) {}
+                                    SobolRsg::DirectionIntegers integers,
+                                    Size batchSize)
+    : ordering_(ordering), seed_(seed), integers_(integers),
+      batchSize_(batchSize) {}
 
     std::shared_ptr<BrownianGenerator>
     SobolBrownianGeneratorFactory::create(Size factors, Size steps) const {
         return std::make_shared<SobolBrownianGenerator>(factors, steps, ordering_,
-                                                    seed_, integers_);
+                                                    seed_, integers_,
+                                                    batchSize_);
+    }
+
+    std::shared_ptr<BrownianGenerator>
+    SobolBrownianGeneratorFactory::createStream(Size factors,
+                                                Size steps,
+                                                Size,
+                                                Size firstPath) const {
+        return std::make_shared<SobolBrownianGenerator>(factors, steps, ordering_,
+                                                    seed_, integers_,
+                                                    batchSize_, firstPath);
     }
 
 }
@@ -33,6 +33,16 @@ namespace QuantLib {
     //! Sobol Brownian generator for market-model simulations
     /*! Incremental Brownian generator using a Sobol generator,
         inverse-cumulative Gaussian method, and Brownian bridging.
+
+        When a batch size greater than one is given, the generator
+        draws and bridges the variates for that many paths at once
+        and returns them one path at a time; the paths are the same
+        as with the default batch size, but the Brownian bridge can
+        loop over the paths of the batch with unit stride.
+
+        The generator can start from any path of the sequence, so
+        that contiguous blocks of paths can be drawn by different
+        threads.
     */
     class SobolBrownianGenerator : public BrownianGenerator {
       public:
@@ -52,7 +62,9 @@ namespace QuantLib {
                            Ordering ordering,
                            unsigned long seed = 0,
                            SobolRsg::DirectionIntegers directionIntegers
-                                                        = SobolRsg::Jaeckel);
+                                                        = SobolRsg::Jaeckel,
+                           Size batchSize = 1,
+                           Size firstPath = 0);
 
         Real nextPath();
         Real nextStep(std::vector<Real>&);
@@ -66,14 +78,19 @@ namespace QuantLib {
                               const std::vector<std::vector<Real> >& variates);
 
       private:
+        void nextBatch();
         Size factors_, steps_;
         Ordering ordering_;
         InverseCumulativeRsg<SobolRsg,InverseCumulativeNormal> generator_;
         BrownianBridge bridge_;
+        Size batchSize_;
         // work variables
-        Size lastStep_;
+        Size lastStep_, currentPath_;
         std::vector<std::vector<Size> > orderedIndices_;
-        std::vector<std::vector<Real> > bridgedVariates_;
+        // variates and bridged variates for the paths of a batch,
+        // stored by factor, step and path
+        std::vector<Real> samples_, variates_, bridgedVariates_;
+        std::vector<Real> weights_;
     };
 
     class SobolBrownianGeneratorFactory : public BrownianGeneratorFactory {
@@ -82,13 +99,22 @@ namespace QuantLib {
                            SobolBrownianGenerator::Ordering ordering,
                            unsigned long seed = 0,
                            SobolRsg::DirectionIntegers directionIntegers
-                                                         = SobolRsg::Jaeckel);
+                                                         = SobolRsg::Jaeckel,
+                           Size batchSize = 1);
         std::shared_ptr<BrownianGenerator> create(Size factors,
                                                     Size steps) const;
+        /*! All streams draw the same sequence; the returned generator
+            skips to the given first path.
+        */
+        std::shared_ptr<BrownianGenerator> createStream(Size factors,
+                                                        Size steps,
+                                                        Size stream,
+                                                        Size firstPath) const;
       private:
         SobolBrownianGenerator::Ordering ordering_;
         unsigned long seed_;
         SobolRsg::DirectionIntegers integers_;
+        Size batchSize_;
     };
 
 }
@@ -0,0 +1,74 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/models/marketmodels/browniangenerators/zigguratbrowniangenerator.hpp>
+#include <ql/math/randomnumbers/rngtraits.hpp>
+#include <algorithm>
+
+namespace QuantLib {
+
+    ZigguratBrownianGenerator::ZigguratBrownianGenerator(Size factors,
+                                                         Size steps,
+                                                         unsigned long seed)
+    : factors_(factors), steps_(steps), lastStep_(0),
+      generator_(seed), variates_(factors*steps) {}
+
+    Real ZigguratBrownianGenerator::nextStep(std::vector<Real>& output) {
+        #if defined(QL_EXTRA_SAFETY_CHECKS)
+        QL_REQUIRE(output.size() == factors_, "size mismatch");
+        QL_REQUIRE(lastStep_<steps_, "sequence exhausted");
+        #endif
+        std::copy(variates_.begin() + lastStep_*factors_,
+                  variates_.begin() + (lastStep_+1)*factors_,
+                  output.begin());
+        ++lastStep_;
+        return 1.0;
+    }
+
+    Real ZigguratBrownianGenerator::nextPath() {
+        generator_.next(variates_.size(), variates_.data());
+        lastStep_ = 0;
+        return 1.0;
+    }
+
+    Size ZigguratBrownianGenerator::numberOfFactors() const {
+        return factors_;
+    }
+
+    Size ZigguratBrownianGenerator::numberOfSteps() const { return steps_; }
+
+
+    ZigguratBrownianGeneratorFactory::ZigguratBrownianGeneratorFactory(
+                                                          unsigned long seed)
+    : seed_(seed) {}
+
+    std::shared_ptr<BrownianGenerator>
+    ZigguratBrownianGeneratorFactory::create(Size factors, Size steps) const {
+        return std::make_shared<ZigguratBrownianGenerator>(factors, steps,
+                                                           seed_);
+    }
+
+    std::shared_ptr<BrownianGenerator>
+    ZigguratBrownianGeneratorFactory::createStream(Size factors,
+                                                   Size steps,
+                                                   Size stream,
+                                                   Size) const {
+        return std::make_shared<ZigguratBrownianGenerator>(
+                    factors, steps, detail::streamSeed(seed_, stream));
+    }
+
+}
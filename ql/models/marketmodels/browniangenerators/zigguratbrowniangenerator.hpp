@@ -0,0 +1,73 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+
+#ifndef quantlib_ziggurat_brownian_generator_hpp
+#define quantlib_ziggurat_brownian_generator_hpp
+
+#include <ql/models/marketmodels/browniangenerator.hpp>
+#include <ql/math/randomnumbers/zigguratrng.hpp>
+
+namespace QuantLib {
+
+    //! Ziggurat Brownian generator for market-model simulations
+    /*! Incremental Brownian generator drawing Gaussian variates
+        directly with the Ziggurat method; the variates for all the
+        steps and factors of a path are drawn at once when the path
+        is started.
+    */
+    class ZigguratBrownianGenerator : public BrownianGenerator {
+      public:
+        ZigguratBrownianGenerator(Size factors,
+                                  Size steps,
+                                  unsigned long seed = 0);
+
+        Real nextStep(std::vector<Real>&);
+        Real nextPath();
+
+        Size numberOfFactors() const;
+        Size numberOfSteps() const;
+      private:
+        Size factors_, steps_;
+        Size lastStep_;
+        ZigguratRng generator_;
+        // variates stored by step and factor
+        std::vector<Real> variates_;
+    };
+
+    class ZigguratBrownianGeneratorFactory : public BrownianGeneratorFactory {
+      public:
+        ZigguratBrownianGeneratorFactory(unsigned long seed = 0);
+        std::shared_ptr<BrownianGenerator> create(Size factors,
+                                                  Size steps) const;
+        /*! The seed of each stream is drawn from a Mersenne-Twister
+            generator initialized with the given seed, as in
+            GenericPseudoRandom; the index of the first path is not
+            used.
+        */
+        std::shared_ptr<BrownianGenerator> createStream(Size factors,
+                                                        Size steps,
+                                                        Size stream,
+                                                        Size firstPath) const;
+      private:
+        unsigned long seed_;
+    };
+
+}
+
+
+#endif
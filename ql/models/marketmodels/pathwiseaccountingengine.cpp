@@ -23,6 +23,8 @@ FOR A PARTICULAR PURPOSE.  See the license for more details.
 #include <ql/models/marketmodels/evolutiondescription.hpp>
 #include <ql/models/marketmodels/curvestate.hpp>
 #include <ql/models/marketmodels/marketmodel.hpp>
+#include <ql/models/marketmodels/browniangenerator.hpp>
+#include <ql/utilities/threadpool.hpp>
 #include <algorithm>
 
 namespace QuantLib {
@@ -117,6 +119,26 @@ namespace QuantLib {
         partials_ = Matrix(pseudoRootStructure_->numberOfFactors(),numberRates_);
     }
 
+    PathwiseAccountingEngine::PathwiseAccountingEngine(
+        EvolverFactory evolverFactory,
+        std::shared_ptr<BrownianGeneratorFactory> generatorFactory,
+        const Clone<MarketModelPathwiseMultiProduct>& product,
+        const std::shared_ptr<MarketModel>& pseudoRootStructure,
+        Real initialNumeraireValue,
+        Size threads)
+    : PathwiseAccountingEngine(std::shared_ptr<LogNormalFwdRateEuler>(),
+                               product, pseudoRootStructure,
+                               initialNumeraireValue) {
+        QL_REQUIRE(evolverFactory, "no evolver factory given");
+        QL_REQUIRE(generatorFactory, "no generator factory given");
+        QL_REQUIRE(threads > 0, "at least one thread required");
+        evolverFactory_ = std::move(evolverFactory);
+        generatorFactory_ = std::move(generatorFactory);
+        threads_ = threads;
+        if (threads_ > 1)
+            pool_ = std::make_shared<ThreadPool>(threads_-1);
+    }
+
     Real PathwiseAccountingEngine::singlePathValues(std::vector<Real>& values)
     {
 
@@ -312,6 +334,10 @@ namespace QuantLib {
     void PathwiseAccountingEngine::multiplePathValues(SequenceStatisticsInc& stats,
         Size numberOfPaths)
     {
+        if (evolverFactory_) {
+            multiThreadedPathValues(stats, numberOfPaths);
+            return;
+        }
         std::vector<Real> values(product_->numberOfProducts()*(numberRates_+1));
         for (Size i=0; i<numberOfPaths; ++i)
         {
@@ -320,6 +346,48 @@ namespace QuantLib {
         }
     }
 
+    void PathwiseAccountingEngine::multiThreadedPathValues(
+                                               SequenceStatisticsInc& stats,
+                                               Size numberOfPaths) {
+        Size blockSize = (numberOfPaths + threads_ - 1) / threads_;
+        std::vector<Size> paths(threads_);
+        std::vector<std::unique_ptr<PathwiseAccountingEngine> >
+                                                          engines(threads_);
+        for (Size i=0; i<threads_; ++i) {
+            Size firstPath = std::min(numberOfPaths, i*blockSize);
+            paths[i] = std::min(numberOfPaths, firstPath + blockSize)
+                - firstPath;
+            StreamBrownianGeneratorFactory factory(
+                                  generatorFactory_, streamsUsed_ + i,
+                                  pathsDrawn_ + firstPath);
+            engines[i] = std::make_unique<PathwiseAccountingEngine>(
+                              evolverFactory_(factory), product_,
+                              pseudoRootStructure_, initialNumeraireValue_);
+        }
+
+        // each thread collects the values of its paths; the results
+        // are merged in path order
+        Size numberValues = numberProducts_*(numberRates_+1);
+        std::vector<SequenceStatisticsInc> threadStats(
+                        threads_, SequenceStatisticsInc(numberValues));
+        auto simulate = [&](Size i) {
+            std::vector<Real> values(numberValues);
+            for (Size j=0; j<paths[i]; ++j) {
+                Real weight = engines[i]->singlePathValues(values);
+                threadStats[i].add(values, weight);
+            }
+        };
+        if (pool_)
+            pool_->parallelFor(threads_, simulate);
+        else
+            simulate(0);
+
+        for (Size i=0; i<threads_; ++i)
+            stats.merge(threadStats[i]);
+        streamsUsed_ += threads_;
+        pathsDrawn_ += numberOfPaths;
+    }
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
  
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1191,6 +1259,359 @@ namespace QuantLib {
 
         } // end of method
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PathwiseVegasAdjointAccountingEngine::PathwiseVegasAdjointAccountingEngine(
+        const std::shared_ptr<LogNormalFwdRateEuler>& evolver, // method relies heavily on LMM Euler
+        const Clone<MarketModelPathwiseMultiProduct>& product,
+        const std::shared_ptr<MarketModel>& pseudoRootStructure, // we need pseudo-roots and displacements
+        const std::vector<std::vector<Matrix> >& vegaBumps,
+        Real initialNumeraireValue)
+        : evolver_(evolver), product_(product), pseudoRootStructure_(pseudoRootStructure),
+        initialNumeraireValue_(initialNumeraireValue),
+        numberProducts_(product->numberOfProducts()),
+        numberRates_(pseudoRootStructure->numberOfRates()),
+        numberSteps_(pseudoRootStructure->numberOfSteps()),
+        factors_(pseudoRootStructure->numberOfFactors()),
+        doDeflation_(!product->alreadyDeflated()),
+        alive_(pseudoRootStructure->evolution().firstAliveRate()),
+        displacements_(pseudoRootStructure->displacements()),
+        taus_(pseudoRootStructure->evolution().rateTaus()),
+        bumpElements_(numberSteps_),
+        numerairesHeld_(numberProducts_),
+        numberCashFlowsThisStep_(numberProducts_),
+        cashFlowsGenerated_(numberProducts_),
+        LIBORRates_(numberSteps_+1, numberRates_),
+        Discounts_(numberSteps_+1, numberRates_+1),
+        brownians_(numberSteps_, factors_),
+        partials_(factors_, numberRates_+1),
+        driftFactors_(numberRates_), driftFactorDerivatives_(numberRates_),
+        weightedAdjoints_(numberRates_),
+        cumulatedDrifts_(factors_),
+        elementaryVegas_(numberRates_, factors_),
+        deflatorAndDerivatives_(numberRates_+1)
+    {
+        QL_REQUIRE(evolver_->numeraires() ==
+                   moneyMarketMeasure(pseudoRootStructure_->evolution()),
+                   "the discretely compounding money-market measure is required");
+
+        QL_REQUIRE(vegaBumps.size() == numberSteps_, "we need one vector of vega bumps for each step.");
+
+        numberBumps_ = vegaBumps[0].size();
+
+        // only the non-null elements of the bumps are kept; the
+        // vegas for each step are then obtained in one pass over them
+        for (Size i=0; i < numberSteps_; ++i)
+        {
+            QL_REQUIRE(vegaBumps[i].size() == numberBumps_,"We must have precisely the same number of bumps for each step.");
+
+            for (Size b=0; b < numberBumps_; ++b)
+            {
+                const Matrix& bump = vegaBumps[i][b];
+                QL_REQUIRE(bump.rows() == numberRates_ && bump.columns() == factors_,
+                           "vega bump " << b << " for step " << i << " is "
+                           << bump.rows() << "x" << bump.columns() << ", "
+                           << numberRates_ << "x" << factors_ << " required");
+
+                for (Size k=alive_[i]; k < numberRates_; ++k)
+                    for (Size f=0; f < factors_; ++f)
+                        if (bump[k][f] != 0.0)
+                            bumpElements_[i].push_back({b, k, f, bump[k][f]});
+            }
+        }
+
+        for (Size i=0; i <= numberSteps_; ++i)
+            Discounts_[i][0] = 1.0;
+
+        Matrix VModel(numberSteps_+1,numberRates_);
+
+        V_.reserve(numberProducts_);
+
+        Matrix  modelCashFlowIndex(product_->possibleCashFlowTimes().size(), numberRates_+1);
+
+        numberCashFlowsThisIndex_.resize(numberProducts_);
+
+        for (Size i=0; i<numberProducts_; ++i)
+        {
+            cashFlowsGenerated_[i].resize(
+                product_->maxNumberOfCashFlowsPerProductPerStep());
+
+            for (Size j=0; j < cashFlowsGenerated_[i].size(); ++j)
+                cashFlowsGenerated_[i][j].amount.resize(numberRates_+1);
+
+            numberCashFlowsThisIndex_[i].resize(product_->possibleCashFlowTimes().size());
+
+            V_.emplace_back(VModel);
+
+            totalCashFlowsThisIndex_.emplace_back(modelCashFlowIndex);
+        }
+
+        vegasThisPath_ = Matrix(numberProducts_, numberBumps_);
+
+        const std::vector<Time>& cashFlowTimes =
+            product_->possibleCashFlowTimes();
+        numberCashFlowTimes_ = cashFlowTimes.size();
+
+        const std::vector<Time>& rateTimes = product_->evolution().rateTimes();
+        const std::vector<Time>& evolutionTimes = product_->evolution().evolutionTimes();
+        discounters_.reserve(cashFlowTimes.size());
+
+        for (Size j=0; j<cashFlowTimes.size(); ++j)
+            discounters_.emplace_back(MarketModelPathwiseDiscounter(cashFlowTimes[j],
+            rateTimes));
+
+        // we need to allocate cash-flow times to steps, i.e. what is the last step completed before a flow occurs
+        // what we really need is for each step, what cash flow time indices to look at
+
+        cashFlowIndicesThisStep_.resize(numberSteps_);
+
+        for (Size i=0; i < numberCashFlowTimes_; ++i)
+        {
+            std::vector<Time>::const_iterator it = std::upper_bound( evolutionTimes.begin(), evolutionTimes.end(), cashFlowTimes[i]);
+            if (it != evolutionTimes.begin())
+                --it;
+            Size index = it - evolutionTimes.begin();
+            cashFlowIndicesThisStep_[index].emplace_back(i);
+        }
+    }
+
+    void PathwiseVegasAdjointAccountingEngine::singlePathValues(std::vector<Real>& values)
+    {
+        // clear accumulation variables
+        for (Size i=0; i < numberProducts_; ++i)
+        {
+            numerairesHeld_[i]=0.0;
+
+            for (Size j=0; j < numberCashFlowTimes_; ++j)
+            {
+                numberCashFlowsThisIndex_[i][j] =0;
+
+                for (Size k=0; k <= numberRates_; ++k)
+                    totalCashFlowsThisIndex_[i][j][k] =0.0;
+            }
+
+            std::fill(V_[i].begin(), V_[i].end(), 0.0);
+        }
+        std::fill(vegasThisPath_.begin(), vegasThisPath_.end(), 0.0);
+
+        const std::vector<Rate>& initialForwards = pseudoRootStructure_->initialRates();
+        std::copy(initialForwards.begin(), initialForwards.end(), LIBORRates_.row_begin(0));
+
+        Real weight = evolver_->startNewPath();
+        product_->reset();
+
+        Size thisStep;
+
+        bool done = false;
+        do {
+            thisStep = evolver_->currentStep();
+            Size storeStep = thisStep+1;
+            weight *= evolver_->advanceStep();
+
+            done = product_->nextTimeStep(evolver_->currentState(),
+                numberCashFlowsThisStep_,
+                cashFlowsGenerated_);
+
+            // store what the backward sweep will need
+            const CurveState& currentState = evolver_->currentState();
+            const std::vector<Rate>& currentForwards = currentState.forwardRates();
+            for (Size i=0; i < numberRates_; ++i)
+            {
+                LIBORRates_[storeStep][i] = currentForwards[i];
+                Discounts_[storeStep][i+1] = currentState.discountRatio(i+1,0);
+            }
+
+            const std::vector<Real>& brownians = evolver_->browniansThisStep();
+            std::copy(brownians.begin(), brownians.end(), brownians_.row_begin(thisStep));
+
+            // for each product...
+            for (Size i=0; i<numberProducts_; ++i)
+            {
+                // ...and each cash flow...
+                for (Size j=0; j<numberCashFlowsThisStep_[i]; ++j)
+                {
+                    Size k = cashFlowsGenerated_[i][j].timeIndex;
+                    ++numberCashFlowsThisIndex_[i][ k];
+
+                    for (Size l=0; l <= numberRates_; ++l)
+                        totalCashFlowsThisIndex_[i][k][l] += cashFlowsGenerated_[i][j].amount[l]*weight;
+
+                }
+            }
+
+        } while (!done);
+
+        // ok we've gathered cash-flows, now the backwards sweep
+
+        bool flowsFound = false;
+
+        Integer finalStepDone = thisStep;
+
+        for (Integer currentStep =  numberSteps_-1; currentStep >=0 ; --currentStep) // must be a signed type as we go negative
+        {
+            Integer stepToUse = std::min<Integer>(currentStep, finalStepDone)+1;
+
+            for (Size k=0; k < cashFlowIndicesThisStep_[currentStep].size(); ++k)
+            {
+                Size cashFlowIndex =cashFlowIndicesThisStep_[currentStep][k];
+
+                // first check to see if anything actually happened before spending time on computing stuff
+                bool noFlows = true;
+                for (Size l=0; l < numberProducts_ && noFlows; ++l)
+                    noFlows = noFlows && (numberCashFlowsThisIndex_[l][cashFlowIndex] ==0);
+
+                flowsFound = flowsFound || !noFlows;
+
+                if (!noFlows)
+                {
+                    if (doDeflation_)
+                        discounters_[cashFlowIndex].getFactors(LIBORRates_, Discounts_,stepToUse, deflatorAndDerivatives_); // get amount to discount cash flow by and amount to multiply its derivatives by
+
+                    for (Size j=0; j < numberProducts_; ++j)
+                    {
+                        if (numberCashFlowsThisIndex_[j][cashFlowIndex] > 0)
+                        {
+                            Real deflatedCashFlow = totalCashFlowsThisIndex_[j][cashFlowIndex][0];
+                            if (doDeflation_)
+                                deflatedCashFlow *= deflatorAndDerivatives_[0];
+                            numerairesHeld_[j] += deflatedCashFlow;
+
+                            for (Size i=1; i <= numberRates_; ++i)
+                            {
+                                Real thisDerivative =  totalCashFlowsThisIndex_[j][cashFlowIndex][i];
+                                if (doDeflation_)
+                                {
+                                    thisDerivative *= deflatorAndDerivatives_[0];
+                                    thisDerivative +=  totalCashFlowsThisIndex_[j][cashFlowIndex][0]*deflatorAndDerivatives_[i];
+                                }
+
+                                V_[j][stepToUse][i-1] += thisDerivative; // zeroth row of V is t =0 not t_0
+                            }
+                        }
+                    }
+                }
+            }
+
+            // need to do backwards updating
+            if (flowsFound)
+            {
+                Integer nextStepToUse  = std::min<Integer>(currentStep-1, finalStepDone);
+                Integer nextStepIndex = nextStepToUse+1;
+                if (nextStepIndex != stepToUse) // then we need to update V and the vegas; here stepToUse == currentStep+1
+                {
+                    const Matrix& A = pseudoRootStructure_->pseudoRoot(currentStep);
+                    Matrix::const_row_iterator Z = brownians_.row_begin(currentStep);
+                    Size alive = alive_[currentStep];
+
+                    // the log-forward of rate r moves by
+                    // sum_{j=alive}^{r} g_j A_r.A_j - A_r.A_r/2 + A_r.Z,
+                    // g_j = tau_j (f_j+d_j)/(1+tau_j f_j) being computed
+                    // with the rates at the start of the step
+                    for (Size r=alive; r < numberRates_; ++r)
+                    {
+                        Real oldRate = LIBORRates_[currentStep][r];
+                        Real oneOverDiscount = 1.0 + taus_[r]*oldRate;
+                        driftFactors_[r] = taus_[r]*(oldRate+displacements_[r])/oneOverDiscount;
+                        driftFactorDerivatives_[r] = taus_[r]*(1.0-taus_[r]*displacements_[r])/
+                            (oneOverDiscount*oneOverDiscount);
+                    }
+
+                    for (Size i=0; i < numberProducts_; ++i)
+                    {
+                        // adjoints of the displaced rates at the end of the step, times the rates
+                        for (Size r=alive; r < numberRates_; ++r)
+                            weightedAdjoints_[r] = V_[i][stepToUse][r]*
+                                (LIBORRates_[stepToUse][r]+displacements_[r]);
+
+                        // partials_[f][r] = sum_{q>=r} weightedAdjoints_[q] A[q][f]
+                        for (Size f=0; f < factors_; ++f)
+                        {
+                            partials_[f][numberRates_] = 0.0;
+                            for (Integer r=numberRates_-1; r >= Integer(alive); --r)
+                                partials_[f][r] = partials_[f][r+1] + weightedAdjoints_[r]*A[r][f];
+                        }
+
+                        // vegas with respect to each element of the pseudo-root
+                        std::fill(cumulatedDrifts_.begin(), cumulatedDrifts_.end(), 0.0);
+                        for (Size k=alive; k < numberRates_; ++k)
+                        {
+                            for (Size f=0; f < factors_; ++f)
+                            {
+                                cumulatedDrifts_[f] += driftFactors_[k]*A[k][f];
+                                elementaryVegas_[k][f] =
+                                    weightedAdjoints_[k]*(Z[f] - A[k][f] + cumulatedDrifts_[f]
+                                                          + driftFactors_[k]*A[k][f])
+                                    + driftFactors_[k]*partials_[f][k+1];
+                            }
+                        }
+
+                        for (const auto& e : bumpElements_[currentStep])
+                            vegasThisPath_[i][e.bump] += e.size*elementaryVegas_[e.rate][e.factor];
+
+                        // adjoints of the rates at the start of the step
+                        for (Size j=0; j < alive; ++j)
+                            V_[i][nextStepIndex][j] = V_[i][stepToUse][j];
+
+                        for (Size j=alive; j < numberRates_; ++j)
+                        {
+                            Real ratio = (LIBORRates_[stepToUse][j]+displacements_[j])/
+                                (LIBORRates_[currentStep][j]+displacements_[j]);
+
+                            Real summandTerm = 0.0;
+                            for (Size f=0; f < factors_; ++f)
+                                summandTerm += A[j][f]*partials_[f][j];
+
+                            V_[i][nextStepIndex][j] = V_[i][stepToUse][j]*ratio
+                                + driftFactorDerivatives_[j]*summandTerm;
+                        }
+                    }
+                }
+            }
+        }
+
+        // write answer into values
+
+        Size entriesPerProduct = 1+numberRates_+numberBumps_;
+
+        for (Size i=0; i < numberProducts_; ++i)
+        {
+            values[i*entriesPerProduct] = numerairesHeld_[i]*initialNumeraireValue_;
+            for (Size j=0; j < numberRates_; ++j)
+                values[i*entriesPerProduct+1+j] = V_[i][0][j]*initialNumeraireValue_;
+            for (Size k=0; k < numberBumps_; ++k)
+                values[i*entriesPerProduct+1+numberRates_+k] = vegasThisPath_[i][k]*initialNumeraireValue_;
+        }
+    }
+
+    void PathwiseVegasAdjointAccountingEngine::multiplePathValues(std::vector<Real>& means, std::vector<Real>& errors,
+        Size numberOfPaths)
+    {
+        std::vector<Real> values(numberProducts_*(1+numberRates_+numberBumps_));
+        means.resize(values.size());
+        errors.resize(values.size());
+        std::vector<Real> sums(values.size(),0.0);
+        std::vector<Real> sumsqs(values.size(),0.0);
+
+        for (Size i=0; i<numberOfPaths; ++i)
+        {
+            singlePathValues(values);
+
+            for (Size j=0; j < values.size(); ++j)
+            {
+                sums[j] += values[j];
+                sumsqs[j] += values[j]*values[j];
+            }
+        }
+
+        for (Size j=0; j < values.size(); ++j)
+        {
+            means[j] = sums[j]/numberOfPaths;
+            Real meanSq = sumsqs[j]/numberOfPaths;
+            Real variance = meanSq - means[j]*means[j];
+            errors[j] = std::sqrt(variance/numberOfPaths);
+        }
+    }
+
 } // end of namespace
 
 
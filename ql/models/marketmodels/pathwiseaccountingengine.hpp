@@ -29,12 +29,15 @@
 
 #include <ql/utilities/clone.hpp>
 #include <ql/types.hpp>
+#include <functional>
 #include <vector>
 
 namespace QuantLib {
 
     class LogNormalFwdRateEuler;
     class MarketModel;
+    class BrownianGeneratorFactory;
+    class ThreadPool;
 
 
     //! Engine collecting cash flows along a market-model simulation for doing pathwise computation of Deltas
@@ -48,11 +51,29 @@ namespace QuantLib {
                          const Clone<MarketModelPathwiseMultiProduct>& product,
                          const std::shared_ptr<MarketModel>& pseudoRootStructure, // we need pseudo-roots and displacements
                          Real initialNumeraireValue);
+        //! builds an evolver drawing from the given generator factory
+        typedef std::function<std::shared_ptr<LogNormalFwdRateEuler>(
+                                const BrownianGeneratorFactory&)>
+            EvolverFactory;
+        //! multi-threaded engine
+        /*! The paths are split among threads as in the multi-threaded
+            AccountingEngine, with the same requirements on the
+            evolvers built by \p evolverFactory.
+        */
+        PathwiseAccountingEngine(EvolverFactory evolverFactory,
+                         std::shared_ptr<BrownianGeneratorFactory>
+                                                           generatorFactory,
+                         const Clone<MarketModelPathwiseMultiProduct>& product,
+                         const std::shared_ptr<MarketModel>& pseudoRootStructure,
+                         Real initialNumeraireValue,
+                         Size threads);
 
         void multiplePathValues(SequenceStatisticsInc& stats,
                                 Size numberOfPaths);
       private:
           Real singlePathValues(std::vector<Real>& values);
+        void multiThreadedPathValues(SequenceStatisticsInc& stats,
+                                     Size numberOfPaths);
 
         std::shared_ptr<LogNormalFwdRateEuler> evolver_;
         Clone<MarketModelPathwiseMultiProduct> product_;
@@ -68,6 +89,13 @@ namespace QuantLib {
 
         bool doDeflation_;
 
+        // multi-threaded simulation
+        EvolverFactory evolverFactory_;
+        std::shared_ptr<BrownianGeneratorFactory> generatorFactory_;
+        Size threads_ = 1;
+        std::shared_ptr<ThreadPool> pool_;
+        Size streamsUsed_ = 0, pathsDrawn_ = 0;
+
 
         // workspace
         std::vector<Real> numerairesHeld_;
@@ -272,6 +300,107 @@ namespace QuantLib {
 */
     };
 
+    //! Engine computing pathwise deltas and vegas by a single adjoint sweep
+    /*! The forward rates, Brownians and cash flows of each path are
+        stored during the simulation; a single backward sweep then
+        propagates the sensitivities of the deflated cash flows with
+        respect to the rates at each step (the adjoint vector V) down
+        to time zero.  At each step, the sensitivities with respect to
+        all the elements of the pseudo-root used in the step are
+        obtained from V in the same sweep, without forming the
+        rate/pseudo-root Jacobians used by
+        PathwiseVegasAccountingEngine and
+        PathwiseVegasOuterAccountingEngine; they are then combined
+        into the sensitivities to the given vega bumps (e.g., those
+        returned by VegaBumpCollection) through their non-null
+        elements only.
+
+        The cost of each path is thus a small multiple of the cost of
+        evolving it, whatever the number of rates and bumps, and
+        standard errors are available for the vegas as well as for
+        the prices and deltas.
+
+        The derivatives are the exact ones of the log-normal Euler
+        step taken by LogNormalFwdRateEuler, including the dependence
+        of the drifts on the forwards at the start of the step and on
+        the displacements.
+
+        Results are laid out as in PathwiseVegasAccountingEngine: for
+        each product, its value, its deltas and its vegas.
+
+        \warning only works with displaced LMM under the discretely
+                 compounding money-market measure.
+
+        This is tested in MarketModelTest::testPathwiseAdjointGreeks
+    */
+    class PathwiseVegasAdjointAccountingEngine
+    {
+      public:
+        PathwiseVegasAdjointAccountingEngine(const std::shared_ptr<LogNormalFwdRateEuler>& evolver, // method relies heavily on LMM Euler
+                         const Clone<MarketModelPathwiseMultiProduct>& product,
+                         const std::shared_ptr<MarketModel>& pseudoRootStructure, // we need pseudo-roots and displacements
+                         const std::vector<std::vector<Matrix> >& vegaBumps,
+                         Real initialNumeraireValue);
+
+        void multiplePathValues(std::vector<Real>& means,
+                                std::vector<Real>& errors,
+                                Size numberOfPaths);
+      private:
+        void singlePathValues(std::vector<Real>& values);
+
+        // non-null element of a vega bump
+        struct BumpElement {
+            Size bump, rate, factor;
+            Real size;
+        };
+
+        std::shared_ptr<LogNormalFwdRateEuler> evolver_;
+        Clone<MarketModelPathwiseMultiProduct> product_;
+        std::shared_ptr<MarketModel> pseudoRootStructure_;
+
+        Real initialNumeraireValue_;
+        Size numberProducts_;
+        Size numberRates_;
+        Size numberCashFlowTimes_;
+        Size numberSteps_;
+        Size factors_;
+        Size numberBumps_;
+
+        bool doDeflation_;
+
+        std::vector<Size> alive_;
+        std::vector<Spread> displacements_;
+        std::vector<Time> taus_;
+        std::vector<std::vector<BumpElement> > bumpElements_; // by step
+
+        // workspace
+        std::vector<Real> numerairesHeld_;
+        std::vector<Size> numberCashFlowsThisStep_;
+        std::vector<std::vector<MarketModelPathwiseMultiProduct::CashFlow> >
+                                                         cashFlowsGenerated_;
+        std::vector<MarketModelPathwiseDiscounter> discounters_;
+
+        std::vector<Matrix> V_;  // one V for each product, with components for each time step and rate
+
+        Matrix LIBORRates_; // dimensions are step and rate number
+        Matrix Discounts_; // dimensions are step and rate number, goes from 0 to n. P(t_0, t_j)
+        Matrix brownians_; // dimensions are step and factor
+
+        Matrix partials_; // dimensions are factor and rate
+        std::vector<Real> driftFactors_, driftFactorDerivatives_; // by rate
+        std::vector<Real> weightedAdjoints_; // by rate
+        std::vector<Real> cumulatedDrifts_; // by factor
+        Matrix elementaryVegas_; // dimensions are rate and factor
+        Matrix vegasThisPath_; // dimensions are product and which vega
+
+        std::vector<Real> deflatorAndDerivatives_;
+
+        std::vector<std::vector<Size> > numberCashFlowsThisIndex_;
+        std::vector<Matrix> totalCashFlowsThisIndex_; // need product cross times cross which sensitivity
+
+        std::vector<std::vector<Size> > cashFlowIndicesThisStep_;
+    };
+
 }
 
 #endif
@@ -54,6 +54,15 @@ namespace QuantLib {
     }
 
 
+    Size Observable::unregisterObserver(Observer *o) {
+        if (settings_.updatesDeferred())
+            settings_.unregisterDeferredObserver(o);
+
+        ObservableTransaction::discard(o);
+
+        return observers_.erase(o);
+    }
+
     void Observable::notifyObservers() {
         if (!settings_.updatesEnabled()) {
             // if updates are only deferred, flag this for later notification
@@ -61,6 +70,10 @@ namespace QuantLib {
             settings_.registerDeferredObservers(observers_);
         }
         else if (observers_.size()) {
+            if (ObservableTransaction::collect(observers_.begin(),
+                                               observers_.end()))
+                return;
+
             bool successful = true;
             std::string errMsg;
             for (iterator i=observers_.begin(); i!=observers_.end(); ++i) {
@@ -92,15 +105,35 @@ namespace QuantLib {
 namespace QuantLib {
 
     void Observable::registerObserver(const std::shared_ptr<Observer::Proxy> &observerProxy) {
-        std::scoped_lock<std::recursive_mutex> lock(mutex_);
-        observers_.insert(observerProxy);
+        std::scoped_lock<std::mutex> lock(mutex_);
+        const std::shared_ptr<const set_type> current =
+            std::atomic_load(&observers_);
+        if (current && current->count(observerProxy) != 0)
+            return;
 
+        const std::shared_ptr<set_type> updated = current
+            ? std::make_shared<set_type>(*current)
+            : std::make_shared<set_type>();
+        updated->insert(observerProxy);
+        std::atomic_store(&observers_,
+                          std::shared_ptr<const set_type>(updated));
     }
 
     void Observable::unregisterObserver(const std::shared_ptr<Observer::Proxy> &observerProxy) {
         {
-            std::scoped_lock<std::recursive_mutex> lock(mutex_);
-            observers_.erase(observerProxy);
+            std::scoped_lock<std::mutex> lock(mutex_);
+            const std::shared_ptr<const set_type> current =
+                std::atomic_load(&observers_);
+            if (current && current->count(observerProxy) != 0) {
+                std::shared_ptr<const set_type> updated;
+                if (current->size() > 1) {
+                    const std::shared_ptr<set_type> copy =
+                        std::make_shared<set_type>(*current);
+                    copy->erase(observerProxy);
+                    updated = copy;
+                }
+                std::atomic_store(&observers_, updated);
+            }
         }
 
         if (settings_.updatesDeferred()) {
@@ -112,37 +145,43 @@ namespace QuantLib {
     }
 
     void Observable::notifyObservers() {
-        if (settings_.updatesEnabled()) {
-            std::scoped_lock<std::recursive_mutex> lock(mutex_);
-            set_type observers_copy_(observers_);
-            for (auto const &o : observers_copy_) {
+        // the snapshot keeps the proxies alive during the notification;
+        // proxies of observers being destroyed meanwhile are inactive
+        const std::shared_ptr<const set_type> observers =
+            std::atomic_load(&observers_);
+        if (!observers)
+            return;
+
+        // within a transaction, the observers are only collected
+        const auto notify = [&observers]() {
+            if (ObservableTransaction::collect(observers->begin(),
+                                               observers->end()))
+                return;
+            for (auto const &o : *observers) {
                 if (o) {
                     o->update();
                 }
             }
+        };
+
+        if (settings_.updatesEnabled()) {
+            notify();
             return;
         }
 
         std::scoped_lock<std::mutex> sLock(settings_.mutex_);
         if (settings_.updatesEnabled()) {
-            std::scoped_lock<std::recursive_mutex> lock(mutex_);
-            set_type observers_copy_(observers_);
-            for (auto const &o : observers_copy_) {
-                if (o) {
-                    o->update();
-                }
-            }
+            notify();
             return;
         } else if (settings_.updatesDeferred()) {
-            std::scoped_lock<std::recursive_mutex> lock(mutex_);
             // if updates are only deferred, flag this for later notification
             // these are held centrally by the settings singleton
-            settings_.registerDeferredObservers(observers_);
+            settings_.registerDeferredObservers(*observers);
         }
     }
 
     Observable::Observable()
-            :observers_(1000), settings_(ObservableSettings::instance()) {}
+            : settings_(ObservableSettings::instance()) {}
 
     Observable::Observable(const Observable &)
             : settings_(ObservableSettings::instance()) {
@@ -153,3 +192,71 @@ namespace QuantLib {
 }
 
 #endif
+
+
+namespace QuantLib {
+
+    thread_local ObservableTransaction* ObservableTransaction::current_ =
+                                                                  nullptr;
+
+    ObservableTransaction::ObservableTransaction()
+    : pending_(true), outer_(current_) {
+        if (outer_ == nullptr)
+            current_ = this;
+    }
+
+    ObservableTransaction::~ObservableTransaction() {
+        try {
+            commit();
+        } catch (...) {
+            // nothing we can do in a destructor; the notifications
+            // were sent anyway
+        }
+    }
+
+    void ObservableTransaction::commit() {
+        if (!pending_)
+            return;
+        pending_ = false;
+        // nested transactions leave the delivery to the outermost one
+        if (outer_ != nullptr)
+            return;
+        current_ = nullptr;
+
+        std::vector<observer_type> order;
+        std::unordered_set<observer_type> observers;
+        order.swap(order_);
+        observers.swap(observers_);
+
+        ObservableSettings& settings = ObservableSettings::instance();
+        if (!settings.updatesEnabled()) {
+#ifdef QL_ENABLE_THREAD_SAFE_OBSERVER_PATTERN
+            std::scoped_lock<std::mutex> sLock(settings.mutex_);
+#endif
+            if (settings.updatesDeferred())
+                settings.registerDeferredObservers(observers);
+            if (!settings.updatesEnabled())
+                return;
+        }
+
+        bool successful = true;
+        std::string errMsg;
+        for (const observer_type& o : order) {
+            // observers destroyed meanwhile were discarded; each of the
+            // others is found once
+            if (observers.erase(o) == 0)
+                continue;
+            try {
+                o->update();
+            } catch (std::exception& e) {
+                successful = false;
+                errMsg = e.what();
+            } catch (...) {
+                successful = false;
+            }
+        }
+        QL_ENSURE(successful,
+                  "could not notify one or more observers: " << errMsg);
+    }
+
+}
@@ -36,6 +36,7 @@ FOR A PARTICULAR PURPOSE.  See the license for more details.
 #include <memory>
 #include <algorithm>
 #include <unordered_set>
+#include <vector>
 
 
 #ifndef QL_ENABLE_THREAD_SAFE_OBSERVER_PATTERN
@@ -46,11 +47,14 @@ namespace QuantLib {
 
     class Observable;
 
+    class ObservableTransaction;
+
     //! global repository for run-time library settings
     class ObservableSettings : public Singleton<ObservableSettings> {
         friend class Singleton<ObservableSettings>;
 
         friend class Observable;
+        friend class ObservableTransaction;
 
     public:
         void disableUpdates(bool deferred = false) {
@@ -85,6 +89,7 @@ namespace QuantLib {
     /*! \ingroup patterns */
     class Observable {
         friend class Observer;
+        friend class ObservableTransaction;
 
     public:
         // constructors, assignment, destructor
@@ -104,6 +109,7 @@ namespace QuantLib {
         void notifyObservers();
 
     private:
+        typedef Observer* observer_type;
         typedef std::unordered_set<Observer *>::iterator iterator;
 
         std::pair<iterator, bool> registerObserver(Observer *);
@@ -195,13 +201,6 @@ namespace QuantLib {
         return observers_.insert(o);
     }
 
-    inline Size Observable::unregisterObserver(Observer *o) {
-        if (settings_.updatesDeferred())
-            settings_.unregisterDeferredObserver(o);
-
-        return observers_.erase(o);
-    }
-
 
     inline Observer::Observer(const Observer &o)
             : observables_(o.observables_) {
@@ -275,6 +274,7 @@ namespace QuantLib {
 
     class Observable;
     class ObservableSettings;
+    class ObservableTransaction;
 
     //! Object that gets notified when a given observable changes
     /*! \ingroup patterns */
@@ -349,9 +349,17 @@ namespace QuantLib {
     };
 
     //! Object that notifies its changes to a set of observers
-    /*! \ingroup patterns */
+    /*! The observers are kept in a copy-on-write set: notification
+        iterates over an immutable snapshot without taking any lock,
+        while registration and unregistration replace the snapshot
+        under a mutex that only writers contend for.  Observers added
+        or removed during a notification might or might not receive it.
+
+        \ingroup patterns
+    */
     class Observable {
         friend class Observer;
+        friend class ObservableTransaction;
       public:
         typedef std::unordered_set<std::shared_ptr<Observer::Proxy> >
             set_type;
@@ -367,11 +375,13 @@ namespace QuantLib {
         */
         void notifyObservers();
       private:
+        typedef std::shared_ptr<Observer::Proxy> observer_type;
         void registerObserver(const std::shared_ptr<Observer::Proxy>&);
         void unregisterObserver(const std::shared_ptr<Observer::Proxy>&);
 
-        set_type observers_;
-        mutable std::recursive_mutex mutex_;
+        // null when there are no observers
+        std::shared_ptr<const set_type> observers_;
+        mutable std::mutex mutex_;
 
         ObservableSettings& settings_;
     };
@@ -380,6 +390,7 @@ namespace QuantLib {
     class ObservableSettings : public Singleton<ObservableSettings> {
         friend class Singleton<ObservableSettings>;
         friend class Observable;
+        friend class ObservableTransaction;
 
     public:
         void disableUpdates(bool deferred=false) {
@@ -558,4 +569,85 @@ namespace QuantLib {
     }
 }
 #endif
+
+namespace QuantLib {
+
+    //! Scoped batch of notifications
+    /*! While an instance is alive, notifications sent by observables
+        on the constructing thread are not delivered; the observers
+        they would reach are collected instead.  When the transaction
+        is committed, each collected observer is notified exactly once,
+        regardless of how many of its observables changed; any further
+        notifications it sends in turn are delivered as usual.  Other
+        threads are not affected.
+
+        Transactions can be nested; inner ones join the outermost one,
+        which delivers all notifications when committed.  If updates
+        were disabled in ObservableSettings in the meantime, the
+        collected observers are deferred or dropped accordingly.
+
+        \warning The transaction must be committed or destroyed on
+                 the thread that created it.
+
+        \ingroup patterns
+    */
+    class ObservableTransaction {
+        friend class Observable;
+      public:
+        ObservableTransaction();
+        ObservableTransaction(const ObservableTransaction&) = delete;
+        ObservableTransaction& operator=(const ObservableTransaction&)
+                                                                 = delete;
+        //! commits the transaction if still pending, ignoring errors
+        ~ObservableTransaction();
+        /*! delivers the collected notifications and ends the
+            transaction.  As in Observable::notifyObservers(), all
+            observers are notified even if some of them throw; an
+            exception is raised afterwards.
+        */
+        void commit();
+        //! whether a transaction is active on the current thread
+        static bool active();
+      private:
+        typedef Observable::observer_type observer_type;
+        template <class I>
+        static bool collect(I begin, I end);
+        static void discard(const observer_type&);
+
+        bool pending_;
+        ObservableTransaction* outer_;
+        // observers in the order in which they were first collected;
+        // the set tells which ones are still waiting for notification
+        std::vector<observer_type> order_;
+        std::unordered_set<observer_type> observers_;
+
+        static thread_local ObservableTransaction* current_;
+    };
+
+
+    // inline definitions
+
+    inline bool ObservableTransaction::active() {
+        return current_ != nullptr;
+    }
+
+    template <class I>
+    inline bool ObservableTransaction::collect(I begin, I end) {
+        ObservableTransaction* t = current_;
+        if (t == nullptr)
+            return false;
+        for (I i=begin; i!=end; ++i) {
+            if (t->observers_.insert(*i).second)
+                t->order_.push_back(*i);
+        }
+        return true;
+    }
+
+    inline void ObservableTransaction::discard(const observer_type& o) {
+        if (current_ != nullptr)
+            current_->observers_.erase(o);
+    }
+
+}
+
 #endif
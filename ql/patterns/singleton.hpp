@@ -42,6 +42,7 @@
 #endif
 
 #include <ql/types.hpp>
+#include <ql/evaluationcontext.hpp>
 #include <memory>
 #include <algorithm>
 #include <map>
@@ -85,6 +86,9 @@ namespace QuantLib {
         as a single implemementation point should synchronization
         features be added.
 
+        A separate instance is kept for each EvaluationContext (or
+        for each session, if sessions are enabled.)
+
         \ingroup patterns
     */
     template<class T>
@@ -147,18 +151,53 @@ namespace QuantLib {
             }
         }
 
-#else //this is not thread safe
+#else
 
 #if defined(QL_ENABLE_SESSIONS)
         Integer id = sessionId();
 #else
-        Integer id = 0;
+        Integer id = EvaluationContext::current();
+#endif
+
+#if (QL_MANAGED == 0)
+        // the instance last used by the calling thread is cached, so
+        // that the shared map is only accessed when the context changes
+        static thread_local Integer cachedId = 0;
+        static thread_local T* cached = nullptr;
+        if (cached != nullptr && cachedId == id)
+            return *cached;
 #endif
 
+        std::lock_guard<std::recursive_mutex> lock(EvaluationContext::mutex());
+
         std::shared_ptr < T > &instance = instances_[id];
-        if (!instance)
+        if (!instance) {
             instance = std::shared_ptr < T > (new T);
 
+            static bool releaserAdded = false;
+            if (!releaserAdded) {
+                releaserAdded = true;
+                EvaluationContext::addReleaser([](Integer context) {
+                    std::shared_ptr<T> released;
+                    {
+                        std::lock_guard<std::recursive_mutex> lock(
+                                                 EvaluationContext::mutex());
+                        auto i = instances_.find(context);
+                        if (i != instances_.end()) {
+                            released.swap(i->second);
+                            instances_.erase(i);
+                        }
+                    }
+                    // the instance is destroyed outside the lock
+                });
+            }
+        }
+
+#if (QL_MANAGED == 0)
+        cachedId = id;
+        cached = instance.get();
+#endif
+
 #endif
 
         return *instance;
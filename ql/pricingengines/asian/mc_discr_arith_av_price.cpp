@@ -51,4 +51,29 @@ namespace QuantLib {
         return discount_ * payoff_(averagePrice);
     }
 
+    void ArithmeticAPOPathPricer::operator()(const PathBatch& paths,
+                                             Real* values) const {
+        Size n = paths.length(), m = paths.size();
+        QL_REQUIRE(n>1, "the paths cannot be empty");
+
+        // the sums are accumulated in place, node by node
+        Size fixings, first;
+        if (paths.timeGrid().mandatoryTimes()[0]==0.0) {
+            // include initial fixing
+            first = 0;
+            fixings = pastFixings_ + n;
+        } else {
+            first = 1;
+            fixings = pastFixings_ + n - 1;
+        }
+        std::fill(values, values+m, runningSum_);
+        for (Size i=first; i<n; ++i) {
+            const Real* prices = paths.values(i);
+            for (Size j=0; j<m; ++j)
+                values[j] += prices[j];
+        }
+        for (Size j=0; j<m; ++j)
+            values[j] = discount_ * payoff_(values[j]/fixings);
+    }
+
 }
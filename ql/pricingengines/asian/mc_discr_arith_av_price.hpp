@@ -64,7 +64,9 @@ namespace QuantLib {
              Size requiredSamples,
              Real requiredTolerance,
              Size maxSamples,
-             BigNatural seed);
+             BigNatural seed,
+             Size threads = 1,
+             Size batchSize = 0);
       protected:
         std::shared_ptr<path_pricer_type> pathPricer() const;
         std::shared_ptr<path_pricer_type> controlPathPricer() const;
@@ -75,7 +77,8 @@ namespace QuantLib {
     };
 
 
-    class ArithmeticAPOPathPricer : public PathPricer<Path> {
+    class ArithmeticAPOPathPricer : public PathPricer<Path>,
+                                    public BatchPathPricer {
       public:
         ArithmeticAPOPathPricer(Option::Type type,
                                 Real strike,
@@ -83,6 +86,7 @@ namespace QuantLib {
                                 Real runningSum = 0.0,
                                 Size pastFixings = 0);
         Real operator()(const Path& path) const;
+        void operator()(const PathBatch& paths, Real* values) const;
       private:
         PlainVanillaPayoff payoff_;
         DiscountFactor discount_;
@@ -103,7 +107,9 @@ namespace QuantLib {
              Size requiredSamples,
              Real requiredTolerance,
              Size maxSamples,
-             BigNatural seed)
+             BigNatural seed,
+             Size threads,
+             Size batchSize)
     : MCDiscreteAveragingAsianEngine<RNG,S>(process,
                                             brownianBridge,
                                             antitheticVariate,
@@ -111,7 +117,9 @@ namespace QuantLib {
                                             requiredSamples,
                                             requiredTolerance,
                                             maxSamples,
-                                            seed) {}
+                                            seed,
+                                            threads,
+                                            batchSize) {}
 
     template <class RNG, class S>
     inline
@@ -177,6 +185,8 @@ namespace QuantLib {
         MakeMCDiscreteArithmeticAPEngine& withSeed(BigNatural seed);
         MakeMCDiscreteArithmeticAPEngine& withAntitheticVariate(bool b = true);
         MakeMCDiscreteArithmeticAPEngine& withControlVariate(bool b = true);
+        MakeMCDiscreteArithmeticAPEngine& withThreads(Size threads);
+        MakeMCDiscreteArithmeticAPEngine& withBatchSize(Size paths);
         // conversion to pricing engine
         operator std::shared_ptr<PricingEngine>() const;
       private:
@@ -186,6 +196,7 @@ namespace QuantLib {
         Real tolerance_;
         bool brownianBridge_;
         BigNatural seed_;
+        Size threads_, batchSize_;
     };
 
     template <class RNG, class S>
@@ -194,7 +205,8 @@ namespace QuantLib {
              const std::shared_ptr<GeneralizedBlackScholesProcess>& process)
     : process_(process), antithetic_(false), controlVariate_(false),
       samples_(Null<Size>()), maxSamples_(Null<Size>()),
-      tolerance_(Null<Real>()), brownianBridge_(true), seed_(0) {}
+      tolerance_(Null<Real>()), brownianBridge_(true), seed_(0),
+      threads_(1), batchSize_(0) {}
 
     template <class RNG, class S>
     inline MakeMCDiscreteArithmeticAPEngine<RNG,S>&
@@ -253,6 +265,20 @@ namespace QuantLib {
         return *this;
     }
 
+    template <class RNG, class S>
+    inline MakeMCDiscreteArithmeticAPEngine<RNG,S>&
+    MakeMCDiscreteArithmeticAPEngine<RNG,S>::withThreads(Size threads) {
+        threads_ = threads;
+        return *this;
+    }
+
+    template <class RNG, class S>
+    inline MakeMCDiscreteArithmeticAPEngine<RNG,S>&
+    MakeMCDiscreteArithmeticAPEngine<RNG,S>::withBatchSize(Size paths) {
+        batchSize_ = paths;
+        return *this;
+    }
+
     template <class RNG, class S>
     inline
     MakeMCDiscreteArithmeticAPEngine<RNG,S>::operator std::shared_ptr<PricingEngine>()
@@ -262,7 +288,9 @@ namespace QuantLib {
                                                 antithetic_, controlVariate_,
                                                 samples_, tolerance_,
                                                 maxSamples_,
-                                                seed_);
+                                                seed_,
+                                                threads_,
+                                                batchSize_);
     }
 
 
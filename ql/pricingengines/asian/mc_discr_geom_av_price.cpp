@@ -58,4 +58,35 @@ namespace QuantLib {
         return discount_ * payoff_(averagePrice);
     }
 
+    void GeometricAPOPathPricer::operator()(const PathBatch& paths,
+                                            Real* values) const {
+        Size n = paths.length() - 1, m = paths.size();
+        QL_REQUIRE(paths.length()>1, "the paths cannot be empty");
+
+        Size fixings = n+pastFixings_;
+        bool initialFixing = paths.timeGrid().mandatoryTimes()[0]==0.0;
+        if (initialFixing)
+            fixings += 1;
+        // the overflow check makes the loop path-dependent,
+        // so that each path is processed separately
+        Real maxValue = QL_MAX_REAL;
+        for (Size j=0; j<m; ++j) {
+            Real product = runningProduct_;
+            if (initialFixing)
+                product *= paths(0, j);
+            Real averagePrice = 1.0;
+            for (Size i=1; i<n+1; i++) {
+                Real price = paths(i, j);
+                if (product < maxValue/price) {
+                    product *= price;
+                } else {
+                    averagePrice *= std::pow(product, 1.0/fixings);
+                    product = price;
+                }
+            }
+            averagePrice *= std::pow(product, 1.0/fixings);
+            values[j] = discount_ * payoff_(averagePrice);
+        }
+    }
+
 }
@@ -65,7 +65,8 @@ namespace QuantLib {
     };
 
 
-    class GeometricAPOPathPricer : public PathPricer<Path> {
+    class GeometricAPOPathPricer : public PathPricer<Path>,
+                                   public BatchPathPricer {
       public:
         GeometricAPOPathPricer(Option::Type type,
                                Real strike,
@@ -73,6 +74,7 @@ namespace QuantLib {
                                Real runningProduct = 1.0,
                                Size pastFixings = 0);
         Real operator()(const Path& path) const;
+        void operator()(const PathBatch& paths, Real* values) const;
       private:
         PlainVanillaPayoff payoff_;
         DiscountFactor discount_;
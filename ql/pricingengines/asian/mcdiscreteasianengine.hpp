@@ -49,6 +49,8 @@ namespace QuantLib {
             path_pricer_type;
         typedef typename McSimulation<SingleVariate,RNG,S>::stats_type
             stats_type;
+        typedef typename McSimulation<SingleVariate,RNG,S>::
+            batch_path_generator_type batch_path_generator_type;
         // constructor
         MCDiscreteAveragingAsianEngine(
              const std::shared_ptr<GeneralizedBlackScholesProcess>& process,
@@ -58,7 +60,9 @@ namespace QuantLib {
              Size requiredSamples,
              Real requiredTolerance,
              Size maxSamples,
-             BigNatural seed);
+             BigNatural seed,
+             Size threads = 1,
+             Size batchSize = 0);
         void calculate() const {
             McSimulation<SingleVariate,RNG,S>::calculate(requiredTolerance_,
                                                          requiredSamples_,
@@ -86,6 +90,25 @@ namespace QuantLib {
             return std::make_shared<path_generator_type>(process_, grid,
                                                  gen, brownianBridge_);
         }
+        std::shared_ptr<path_generator_type>
+        streamPathGenerator(Size stream, Size firstSample) const {
+
+            TimeGrid grid = this->timeGrid();
+            typename RNG::rsg_type gen =
+                RNG::make_sequence_generator(grid.size()-1, seed_,
+                                             stream, firstSample);
+            return std::make_shared<path_generator_type>(process_, grid,
+                                                 gen, brownianBridge_);
+        }
+        std::shared_ptr<batch_path_generator_type>
+        batchPathGenerator() const {
+
+            TimeGrid grid = this->timeGrid();
+            typename RNG::rsg_type gen =
+                RNG::make_sequence_generator(grid.size()-1,seed_);
+            return std::make_shared<batch_path_generator_type>(
+                                     process_, grid, gen, brownianBridge_);
+        }
         Real controlVariateValue() const;
         // data members
         std::shared_ptr<GeneralizedBlackScholesProcess> process_;
@@ -108,8 +131,11 @@ namespace QuantLib {
              Size requiredSamples,
              Real requiredTolerance,
              Size maxSamples,
-             BigNatural seed)
-    : McSimulation<SingleVariate,RNG,S>(antitheticVariate, controlVariate),
+             BigNatural seed,
+             Size threads,
+             Size batchSize)
+    : McSimulation<SingleVariate,RNG,S>(antitheticVariate, controlVariate,
+                                        threads, batchSize),
       process_(process), requiredSamples_(requiredSamples),
       maxSamples_(maxSamples), requiredTolerance_(requiredTolerance),
       brownianBridge_(brownianBridge), seed_(seed) {
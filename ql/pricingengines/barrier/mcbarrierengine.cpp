@@ -23,6 +23,56 @@
 
 namespace QuantLib {
 
+    namespace {
+
+        void checkBarrierType(Barrier::Type type, bool& knockIn, bool& down) {
+            switch (type) {
+              case Barrier::DownIn:
+                knockIn = true;
+                down = true;
+                break;
+              case Barrier::UpIn:
+                knockIn = true;
+                down = false;
+                break;
+              case Barrier::DownOut:
+                knockIn = false;
+                down = true;
+                break;
+              case Barrier::UpOut:
+                knockIn = false;
+                down = false;
+                break;
+              default:
+                QL_FAIL("unknown barrier type");
+            }
+        }
+
+        // values of a batch of paths given the node at which each
+        // of them crossed the barrier (if any)
+        void barrierValues(const PathBatch& paths,
+                           const std::vector<Size>& knockNodes,
+                           bool knockIn,
+                           const PlainVanillaPayoff& payoff,
+                           Real rebate,
+                           const std::vector<DiscountFactor>& discounts,
+                           Real* values) {
+            static Size null = Null<Size>();
+            const Real* prices = paths.values(paths.length()-1);
+            for (Size j=0; j<paths.size(); ++j) {
+                bool isOptionActive =
+                    knockIn ? knockNodes[j] != null : knockNodes[j] == null;
+                if (isOptionActive)
+                    values[j] = payoff(prices[j]) * discounts.back();
+                else if (knockIn)
+                    values[j] = rebate*discounts.back();
+                else
+                    values[j] = rebate*discounts[knockNodes[j]];
+            }
+        }
+
+    }
+
     BarrierPathPricer::BarrierPathPricer(
                     Barrier::Type barrierType,
                     Real barrier,
@@ -157,6 +207,53 @@ namespace QuantLib {
     }
 
 
+    void BarrierPathPricer::operator()(const PathBatch& paths,
+                                       Real* values) const {
+        static Size null = Null<Size>();
+        Size n = paths.length(), m = paths.size();
+        QL_REQUIRE(n>1, "the paths cannot be empty");
+
+        bool knockIn, down;
+        checkBarrierType(barrierType_, knockIn, down);
+
+        // the deviates are drawn in the same order as by the
+        // single-path pricer and stored by time step like the paths
+        std::vector<Real> u((n-1)*m);
+        for (Size j=0; j<m; ++j) {
+            const std::vector<Real>& v = sequenceGen_.nextSequence().value;
+            for (Size i=0; i<n-1; ++i)
+                u[i*m+j] = v[i];
+        }
+
+        const TimeGrid& timeGrid = paths.timeGrid();
+        std::vector<Size> knockNodes(m, null);
+        for (Size i=0; i<n-1; ++i) {
+            const Real* asset_prices = paths.values(i);
+            const Real* new_asset_prices = paths.values(i+1);
+            const Real* ui = u.data() + i*m;
+            Time dt = timeGrid.dt(i);
+            for (Size j=0; j<m; ++j) {
+                // terminal or initial vol?
+                Volatility vol =
+                    diffProcess_->diffusion(timeGrid[i], asset_prices[j]);
+                Real x = std::log(new_asset_prices[j] / asset_prices[j]);
+                Real y;
+                if (down)
+                    y = 0.5*(x - std::sqrt(x*x - 2*vol*vol*dt*std::log(ui[j])));
+                else
+                    y = 0.5*(x + std::sqrt(x*x - 2*vol*vol*dt*std::log((1-ui[j]))));
+                y = asset_prices[j] * std::exp(y);
+                if (knockNodes[j] == null &&
+                    (down ? y <= barrier_ : y >= barrier_))
+                    knockNodes[j] = i+1;
+            }
+        }
+
+        barrierValues(paths, knockNodes, knockIn, payoff_, rebate_,
+                      discounts_, values);
+    }
+
+
     BiasedBarrierPathPricer::BiasedBarrierPathPricer(
                                  Barrier::Type barrierType,
                                  Real barrier,
@@ -248,4 +345,28 @@ namespace QuantLib {
         }
     }
 
+    void BiasedBarrierPathPricer::operator()(const PathBatch& paths,
+                                             Real* values) const {
+        static Size null = Null<Size>();
+        Size n = paths.length(), m = paths.size();
+        QL_REQUIRE(n>1, "the paths cannot be empty");
+
+        bool knockIn, down;
+        checkBarrierType(barrierType_, knockIn, down);
+
+        std::vector<Size> knockNodes(m, null);
+        for (Size i=1; i<n; ++i) {
+            const Real* asset_prices = paths.values(i);
+            for (Size j=0; j<m; ++j) {
+                if (knockNodes[j] == null &&
+                    (down ? asset_prices[j] <= barrier_
+                          : asset_prices[j] >= barrier_))
+                    knockNodes[j] = i;
+            }
+        }
+
+        barrierValues(paths, knockNodes, knockIn, payoff_, rebate_,
+                      discounts_, values);
+    }
+
 }
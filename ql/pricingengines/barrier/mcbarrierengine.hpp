@@ -63,6 +63,8 @@ namespace QuantLib {
             path_pricer_type;
         typedef typename McSimulation<SingleVariate,RNG,S>::stats_type
             stats_type;
+        typedef typename McSimulation<SingleVariate,RNG,S>::
+            batch_path_generator_type batch_path_generator_type;
         // constructor
         MCBarrierEngine(
              const std::shared_ptr<GeneralizedBlackScholesProcess>& process,
@@ -74,7 +76,9 @@ namespace QuantLib {
              Real requiredTolerance,
              Size maxSamples,
              bool isBiased,
-             BigNatural seed);
+             BigNatural seed,
+             Size threads = 1,
+             Size batchSize = 0);
         void calculate() const {
             Real spot = process_->x0();
             QL_REQUIRE(spot >= 0.0, "negative or null underlying given");
@@ -97,6 +101,23 @@ namespace QuantLib {
             return std::make_shared<path_generator_type>(process_,
                                                  grid, gen, brownianBridge_);
         }
+        std::shared_ptr<path_generator_type>
+        streamPathGenerator(Size stream, Size firstSample) const {
+            TimeGrid grid = timeGrid();
+            typename RNG::rsg_type gen =
+                RNG::make_sequence_generator(grid.size()-1, seed_,
+                                             stream, firstSample);
+            return std::make_shared<path_generator_type>(process_,
+                                                 grid, gen, brownianBridge_);
+        }
+        std::shared_ptr<batch_path_generator_type>
+        batchPathGenerator() const {
+            TimeGrid grid = timeGrid();
+            typename RNG::rsg_type gen =
+                RNG::make_sequence_generator(grid.size()-1,seed_);
+            return std::make_shared<batch_path_generator_type>(process_,
+                                                 grid, gen, brownianBridge_);
+        }
         std::shared_ptr<path_pricer_type> pathPricer() const;
         // data members
         std::shared_ptr<GeneralizedBlackScholesProcess> process_;
@@ -125,6 +146,8 @@ namespace QuantLib {
         MakeMCBarrierEngine& withMaxSamples(Size samples);
         MakeMCBarrierEngine& withBias(bool b = true);
         MakeMCBarrierEngine& withSeed(BigNatural seed);
+        MakeMCBarrierEngine& withThreads(Size threads);
+        MakeMCBarrierEngine& withBatchSize(Size paths);
         // conversion to pricing engine
         operator std::shared_ptr<PricingEngine>() const;
       private:
@@ -133,10 +156,12 @@ namespace QuantLib {
         Size steps_, stepsPerYear_, samples_, maxSamples_;
         Real tolerance_;
         BigNatural seed_;
+        Size threads_, batchSize_;
     };
 
 
-    class BarrierPathPricer : public PathPricer<Path> {
+    class BarrierPathPricer : public PathPricer<Path>,
+                              public BatchPathPricer {
       public:
         BarrierPathPricer(
                     Barrier::Type barrierType,
@@ -148,6 +173,12 @@ namespace QuantLib {
                     const std::shared_ptr<StochasticProcess1D>& diffProcess,
                     const PseudoRandom::ursg_type& sequenceGen);
         Real operator()(const Path& path) const;
+        /*! \note the uniform deviates for the Brownian-bridge
+                  correction are drawn path by path; therefore, the
+                  results are the same as in the path-by-path
+                  simulation unless antithetic paths are used.
+        */
+        void operator()(const PathBatch& paths, Real* values) const;
       private:
         Barrier::Type barrierType_;
         Real barrier_;
@@ -159,7 +190,8 @@ namespace QuantLib {
     };
 
 
-    class BiasedBarrierPathPricer : public PathPricer<Path> {
+    class BiasedBarrierPathPricer : public PathPricer<Path>,
+                                    public BatchPathPricer {
       public:
         BiasedBarrierPathPricer(Barrier::Type barrierType,
                                 Real barrier,
@@ -168,6 +200,7 @@ namespace QuantLib {
                                 Real strike,
                                 const std::vector<DiscountFactor>& discounts);
         Real operator()(const Path& path) const;
+        void operator()(const PathBatch& paths, Real* values) const;
       private:
         Barrier::Type barrierType_;
         Real barrier_;
@@ -191,8 +224,11 @@ namespace QuantLib {
              Real requiredTolerance,
              Size maxSamples,
              bool isBiased,
-             BigNatural seed)
-    : McSimulation<SingleVariate,RNG,S>(antitheticVariate, false),
+             BigNatural seed,
+             Size threads,
+             Size batchSize)
+    : McSimulation<SingleVariate,RNG,S>(antitheticVariate, false, threads,
+                                        batchSize),
       process_(process), timeSteps_(timeSteps),
       timeStepsPerYear_(timeStepsPerYear),
       requiredSamples_(requiredSamples), maxSamples_(maxSamples),
@@ -273,7 +309,7 @@ namespace QuantLib {
     : process_(process), brownianBridge_(false), antithetic_(false),
       biased_(false), steps_(Null<Size>()), stepsPerYear_(Null<Size>()),
       samples_(Null<Size>()), maxSamples_(Null<Size>()),
-      tolerance_(Null<Real>()), seed_(0) {}
+      tolerance_(Null<Real>()), seed_(0), threads_(1), batchSize_(0) {}
 
     template <class RNG, class S>
     inline MakeMCBarrierEngine<RNG,S>&
@@ -345,6 +381,20 @@ namespace QuantLib {
         return *this;
     }
 
+    template <class RNG, class S>
+    inline MakeMCBarrierEngine<RNG,S>&
+    MakeMCBarrierEngine<RNG,S>::withThreads(Size threads) {
+        threads_ = threads;
+        return *this;
+    }
+
+    template <class RNG, class S>
+    inline MakeMCBarrierEngine<RNG,S>&
+    MakeMCBarrierEngine<RNG,S>::withBatchSize(Size paths) {
+        batchSize_ = paths;
+        return *this;
+    }
+
     template <class RNG, class S>
     inline
     MakeMCBarrierEngine<RNG,S>::operator std::shared_ptr<PricingEngine>()
@@ -361,7 +411,9 @@ namespace QuantLib {
                                    samples_, tolerance_,
                                    maxSamples_,
                                    biased_,
-                                   seed_);
+                                   seed_,
+                                   threads_,
+                                   batchSize_);
     }
 
 }
@@ -57,10 +57,13 @@ namespace QuantLib {
                                Real requiredTolerance,
                                Size maxSamples,
                                BigNatural seed,
-                               Size nCalibrationSamples = Null<Size>());
+                               Size nCalibrationSamples = Null<Size>(),
+                               bool streamingCalibration = false);
       protected:
         std::shared_ptr<LongstaffSchwartzPathPricer<MultiPath> >
             lsmPathPricer() const;
+      private:
+        const bool streamingCalibration_;
     };
 
 
@@ -80,6 +83,7 @@ namespace QuantLib {
         MakeMCAmericanBasketEngine& withMaxSamples(Size samples);
         MakeMCAmericanBasketEngine& withSeed(BigNatural seed);
         MakeMCAmericanBasketEngine& withCalibrationSamples(Size samples);
+        MakeMCAmericanBasketEngine& withStreamingCalibration(bool b = true);
         // conversion to pricing engine
         operator std::shared_ptr<PricingEngine>() const;
       private:
@@ -88,6 +92,7 @@ namespace QuantLib {
         Size steps_, stepsPerYear_, samples_, maxSamples_, calibrationSamples_;
         Real tolerance_;
         BigNatural seed_;
+        bool streamingCalibration_;
     };
 
 
@@ -126,7 +131,8 @@ namespace QuantLib {
                    Real requiredTolerance,
                    Size maxSamples,
                    BigNatural seed,
-                   Size nCalibrationSamples)
+                   Size nCalibrationSamples,
+                   bool streamingCalibration)
         : MCLongstaffSchwartzEngine<BasketOption::engine,
                                     MultiVariate,RNG>(processes,
                                                       timeSteps,
@@ -138,7 +144,8 @@ namespace QuantLib {
                                                       requiredTolerance,
                                                       maxSamples,
                                                       seed,
-                                                      nCalibrationSamples) {}
+                                                      nCalibrationSamples),
+          streamingCalibration_(streamingCalibration) {}
 
     template <class RNG>
     inline std::shared_ptr<LongstaffSchwartzPathPricer<MultiPath> >
@@ -169,7 +176,8 @@ namespace QuantLib {
         return std::make_shared<LongstaffSchwartzPathPricer<MultiPath>>(
                      this->timeGrid(),
                      earlyExercisePathPricer,
-                     *(process->riskFreeRate()));
+                     *(process->riskFreeRate()),
+                     streamingCalibration_);
     }
 
 
@@ -180,7 +188,7 @@ namespace QuantLib {
       steps_(Null<Size>()), stepsPerYear_(Null<Size>()),
       samples_(Null<Size>()), maxSamples_(Null<Size>()),
       calibrationSamples_(Null<Size>()),
-      tolerance_(Null<Real>()), seed_(0) {}
+      tolerance_(Null<Real>()), seed_(0), streamingCalibration_(false) {}
 
     template <class RNG>
     inline MakeMCAmericanBasketEngine<RNG>&
@@ -252,6 +260,13 @@ namespace QuantLib {
         return *this;
     }
 
+    template <class RNG>
+    inline MakeMCAmericanBasketEngine<RNG>&
+    MakeMCAmericanBasketEngine<RNG>::withStreamingCalibration(bool b) {
+        streamingCalibration_ = b;
+        return *this;
+    }
+
     template <class RNG>
     inline
     MakeMCAmericanBasketEngine<RNG>::operator
@@ -269,7 +284,8 @@ namespace QuantLib {
                                         tolerance_,
                                         maxSamples_,
                                         seed_,
-                                        calibrationSamples_);
+                                        calibrationSamples_,
+                                        streamingCalibration_);
     }
 
 }
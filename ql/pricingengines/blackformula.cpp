@@ -579,4 +579,76 @@ namespace QuantLib {
     }
 
 
+
+    void blackFormulaBatch(Size n,
+                           const Option::Type* optionTypes,
+                           const Real* strikes,
+                           const Real* forwards,
+                           const Real* stdDevs,
+                           const Real* discounts,
+                           Real* values,
+                           Real* deltas,
+                           Real* gammas,
+                           Real* vegas) {
+        for (Size i=0; i<n; ++i) {
+            checkParameters(strikes[i], forwards[i], 0.0);
+            QL_REQUIRE(stdDevs[i]>=0.0,
+                       "stdDev (" << stdDevs[i] << ") must be non-negative");
+            QL_REQUIRE(discounts[i]>0.0,
+                       "discount (" << discounts[i] << ") must be positive");
+        }
+
+        // the options are processed in blocks so that the
+        // sensitivities can be stored in local buffers and only
+        // copied to the outputs that were requested
+        const Size blockSize = 256;
+        Real phi[blockSize], delta[blockSize], gamma[blockSize],
+            vega[blockSize];
+
+        for (Size begin=0; begin<n; begin+=blockSize) {
+            const Size size = std::min(blockSize, n-begin);
+            const Option::Type* w = optionTypes + begin;
+            const Real* k = strikes + begin;
+            const Real* f = forwards + begin;
+            const Real* sd = stdDevs + begin;
+            const Real* df = discounts + begin;
+            Real* v = values + begin;
+
+            for (Size i=0; i<size; ++i)
+                phi[i] = w[i];
+
+            for (Size i=0; i<size; ++i) {
+                // zero strikes and standard deviations give the
+                // intrinsic value; the guards keep the Black terms
+                // finite, so that both can be blended without branches
+                const Real stdDev = sd[i] > 0.0 ? sd[i] : 1.0;
+                const Real strike = k[i] > 0.0 ? k[i] : f[i];
+                const Real black = (sd[i] > 0.0 && k[i] > 0.0) ? 1.0 : 0.0;
+
+                const Real d1 = std::log(f[i]/strike)/stdDev + 0.5*stdDev;
+                const Real d2 = d1 - stdDev;
+                const Real nd1 = detail::cumulativeNormal(phi[i]*d1);
+                const Real nd2 = detail::cumulativeNormal(phi[i]*d2);
+                const Real density =
+                    M_SQRT1_2*M_1_SQRTPI*std::exp(-0.5*d1*d1);
+
+                const Real moneyness = phi[i]*(f[i]-k[i]);
+                const Real itm = moneyness > 0.0 ? 1.0 : 0.0;
+
+                v[i] = df[i]*(black*phi[i]*(f[i]*nd1 - k[i]*nd2)
+                              + (1.0-black)*itm*moneyness);
+                delta[i] = df[i]*phi[i]*(black*nd1 + (1.0-black)*itm);
+                gamma[i] = black*df[i]*density/(f[i]*stdDev);
+                vega[i] = black*df[i]*f[i]*density;
+            }
+
+            if (deltas != nullptr)
+                std::copy(delta, delta+size, deltas+begin);
+            if (gammas != nullptr)
+                std::copy(gamma, gamma+size, gammas+begin);
+            if (vegas != nullptr)
+                std::copy(vega, vega+size, vegas+begin);
+        }
+    }
+
 }
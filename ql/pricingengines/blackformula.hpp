@@ -57,6 +57,37 @@ namespace QuantLib {
                       Real discount = 1.0,
                       Real displacement = 0.0);
 
+    /*! Black 1976 formula and its sensitivities for a batch of \p n
+        options, given as contiguous arrays.
+
+        On return, values[i] holds the option price, deltas[i] and
+        gammas[i] its first and second derivatives with respect to the
+        forward, and vegas[i] its derivative with respect to the
+        standard deviation.  Sensitivity outputs that are not needed
+        can be null.
+
+        The main loop contains no branches or virtual calls and uses
+        a branchless approximation of the cumulative normal
+        distribution, so that it can be vectorized by the compiler
+        when vectorized versions of std::log and std::exp are
+        available (e.g., GCC with glibc and -ffast-math).  Input
+        checks are the same as for the scalar formula.
+
+        \warning instead of volatility it uses standard deviation,
+                 i.e. volatility*sqrt(timeToMaturity). If T is the time
+                 to maturity Black vega would be vegas[i]*sqrt(T)
+    */
+    void blackFormulaBatch(Size n,
+                           const Option::Type* optionTypes,
+                           const Real* strikes,
+                           const Real* forwards,
+                           const Real* stdDevs,
+                           const Real* discounts,
+                           Real* values,
+                           Real* deltas = nullptr,
+                           Real* gammas = nullptr,
+                           Real* vegas = nullptr);
+
 
     /*! Approximated Black 1976 implied standard deviation,
         i.e. volatility*sqrt(timeToMaturity).
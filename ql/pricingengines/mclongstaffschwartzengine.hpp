@@ -186,20 +186,26 @@ namespace QuantLib {
         pathPricer_ = this->lsmPathPricer();
         Size dimensions = process_->factors();
         TimeGrid grid = this->timeGrid();
-        typename RNG_Calibration::rsg_type generator =
-            RNG_Calibration::make_sequence_generator(
-                dimensions * (grid.size() - 1), seedCalibration_);
-        std::shared_ptr<path_generator_type_calibration>
-            pathGeneratorCalibration =
-                std::make_shared<path_generator_type_calibration>(
-                    process_, grid, generator, brownianBridgeCalibration_);
-        mcModelCalibration_ =
-            std::make_shared<MonteCarloModel<MC, RNG_Calibration, S>>(
-                    pathGeneratorCalibration, pathPricer_, stats_type(),
-                    this->antitheticVariateCalibration_);
+        // in streaming mode, the path pricer needs the same calibration
+        // paths once for each exercise date
+        const Size passes = pathPricer_->calibrationPasses();
+        for (Size pass=0; pass<passes; ++pass) {
+            typename RNG_Calibration::rsg_type generator =
+                RNG_Calibration::make_sequence_generator(
+                    dimensions * (grid.size() - 1), seedCalibration_);
+            std::shared_ptr<path_generator_type_calibration>
+                pathGeneratorCalibration =
+                    std::make_shared<path_generator_type_calibration>(
+                        process_, grid, generator,
+                        brownianBridgeCalibration_);
+            mcModelCalibration_ =
+                std::make_shared<MonteCarloModel<MC, RNG_Calibration, S>>(
+                        pathGeneratorCalibration, pathPricer_, stats_type(),
+                        this->antitheticVariateCalibration_);
 
-        mcModelCalibration_->addSamples(nCalibrationSamples_);
-        pathPricer_->calibrate();
+            mcModelCalibration_->addSamples(nCalibrationSamples_);
+            pathPricer_->calibrate();
+        }
         // pricing
         McSimulation<MC,RNG,S>::calculate(requiredTolerance_,
                                           requiredSamples_,
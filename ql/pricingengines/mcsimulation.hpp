@@ -27,6 +27,7 @@
 #define quantlib_montecarlo_engine_hpp
 
 #include <ql/grid.hpp>
+#include <ql/methods/montecarlo/batchpathgenerator.hpp>
 #include <ql/methods/montecarlo/montecarlomodel.hpp>
 
 namespace QuantLib {
@@ -37,6 +38,21 @@ namespace QuantLib {
         Carlo engine.
 
         See McVanillaEngine as an example.
+
+        When more than one thread is requested, samples are drawn by
+        a set of worker threads, each with its own path generator
+        (obtained from streamPathGenerator()) and path pricer; results
+        are reproducible for a given seed and number of threads.  For
+        a fixed number of samples, generators that can skip ahead
+        (low-discrepancy and counter-based ones) split a single
+        sequence among threads, so that results don't depend on the
+        number of threads either; such simulations can't be extended
+        afterwards.
+
+        When a batch size is given, paths are drawn and priced in
+        batches of the given size (obtained from batchPathGenerator())
+        instead of one at a time; the paths are the same as in the
+        path-by-path simulation.
     */
 
     template <template <class> class MC, class RNG, class S = Statistics>
@@ -49,6 +65,8 @@ namespace QuantLib {
         typedef typename MonteCarloModel<MC,RNG,S>::stats_type
             stats_type;
         typedef typename MonteCarloModel<MC,RNG,S>::result_type result_type;
+        typedef BatchPathGenerator<typename RNG::rsg_type>
+            batch_path_generator_type;
 
         virtual ~McSimulation() {}
         //! add samples until the required absolute tolerance is reached
@@ -67,12 +85,42 @@ namespace QuantLib {
                        Size maxSamples) const;
       protected:
         McSimulation(bool antitheticVariate,
-                     bool controlVariate)
+                     bool controlVariate,
+                     Size threads = 1,
+                     Size batchSize = 0)
         : antitheticVariate_(antitheticVariate),
-          controlVariate_(controlVariate) {}
+          controlVariate_(controlVariate), threads_(threads),
+          batchSize_(batchSize) {
+            QL_REQUIRE(threads_ > 0, "at least one thread required");
+            QL_REQUIRE(batchSize_ == 0 || threads_ == 1,
+                       "batch simulation not available with "
+                       "multiple threads");
+        }
         virtual std::shared_ptr<path_pricer_type> pathPricer() const = 0;
         virtual std::shared_ptr<path_generator_type> pathGenerator()
                                                                    const = 0;
+        //! path generator for one of the threads of the simulation
+        /*! Engines supporting multi-threaded simulation must return a
+            generator drawing from the given stream of random numbers
+            (see the stream factories in rngtraits.hpp).  For a fixed
+            number of samples, the first sample drawn by the thread
+            has index \p firstSample in the simulation; for open-ended
+            simulations, \p firstSample is Null<Size>().
+        */
+        virtual std::shared_ptr<path_generator_type>
+        streamPathGenerator(Size stream, Size firstSample) const {
+            QL_FAIL("multi-threaded simulation not supported by engine");
+        }
+        //! generator of batches of paths
+        /*! Engines supporting batch simulation must return a generator
+            drawing the same paths as the one returned by
+            pathGenerator(); their path pricers must implement the
+            BatchPathPricer interface.
+        */
+        virtual std::shared_ptr<batch_path_generator_type>
+        batchPathGenerator() const {
+            QL_FAIL("batch simulation not supported by engine");
+        }
         virtual TimeGrid timeGrid() const = 0;
         virtual std::shared_ptr<path_pricer_type> controlPathPricer() const {
             return std::shared_ptr<path_pricer_type>();
@@ -97,6 +145,10 @@ namespace QuantLib {
         
         mutable std::shared_ptr<MonteCarloModel<MC,RNG,S> > mcModel_;
         bool antitheticVariate_, controlVariate_;
+        Size threads_;
+        Size batchSize_;
+        // whether a fixed number of samples was split among threads
+        mutable bool splitSamples_ = false;
     };
 
 
@@ -148,6 +200,11 @@ namespace QuantLib {
         QL_REQUIRE(samples>=sampleNumber,
                    "number of already simulated samples (" << sampleNumber
                    << ") greater than requested samples (" << samples << ")");
+        // the blocks drawn by the threads were sized on the first
+        // batch and cannot be extended
+        QL_REQUIRE(!splitSamples_ || sampleNumber == 0,
+                   "cannot add samples to a multi-threaded simulation "
+                   "with a fixed number of samples");
 
         mcModel_->addSamples(samples-sampleNumber);
 
@@ -165,7 +222,54 @@ namespace QuantLib {
                    "neither tolerance nor number of samples set");
 
         //! Initialize the one-factor Monte Carlo
-        if (this->controlVariate_) {
+        splitSamples_ = false;
+        if (this->threads_ > 1) {
+
+            QL_REQUIRE(RNG::allowsErrorEstimate ||
+                       (requiredSamples != Null<Size>() &&
+                        requiredTolerance == Null<Real>()),
+                       "a fixed number of samples is required for "
+                       "multi-threaded low-discrepancy simulations");
+            // a fixed number of samples is drawn in a single batch,
+            // whose blocks can be taken from a single sequence
+            splitSamples_ = requiredTolerance == Null<Real>();
+
+            result_type controlVariateValue = result_type();
+            if (this->controlVariate_) {
+                controlVariateValue = this->controlVariateValue();
+                QL_REQUIRE(controlVariateValue != Null<result_type>(),
+                           "engine does not provide "
+                           "control-variation price");
+                QL_REQUIRE(!this->controlPathGenerator(),
+                           "control-variation path generator not "
+                           "supported in multi-threaded simulations");
+            }
+
+            std::vector<std::shared_ptr<path_generator_type> >
+                generators(this->threads_);
+            std::vector<std::shared_ptr<path_pricer_type> >
+                pricers(this->threads_), controlPricers;
+            for (Size i=0; i<this->threads_; ++i) {
+                Size firstSample = splitSamples_ ?
+                    MonteCarloModel<MC,RNG,S>::firstThreadSample(
+                                      requiredSamples, this->threads_, i) :
+                    Null<Size>();
+                generators[i] = this->streamPathGenerator(i, firstSample);
+                pricers[i] = this->pathPricer();
+                if (this->controlVariate_) {
+                    controlPricers.push_back(this->controlPathPricer());
+                    QL_REQUIRE(controlPricers.back(),
+                               "engine does not provide "
+                               "control-variation path pricer");
+                }
+            }
+
+            this->mcModel_ =
+                std::make_shared<MonteCarloModel<MC,RNG,S>>(
+                           generators, pricers, stats_type(),
+                           this->antitheticVariate_, controlPricers,
+                           controlVariateValue);
+        } else if (this->controlVariate_) {
 
             result_type controlVariateValue = this->controlVariateValue();
             QL_REQUIRE(controlVariateValue != Null<result_type>(),
@@ -193,6 +297,10 @@ namespace QuantLib {
                            this->antitheticVariate_);
         }
 
+        if (this->batchSize_ > 0)
+            this->mcModel_->setBatchPathGenerator(this->batchPathGenerator(),
+                                                  this->batchSize_);
+
         if (requiredTolerance != Null<Real>()) {
             if (maxSamples != Null<Size>())
                 this->value(requiredTolerance, maxSamples);
@@ -118,11 +118,15 @@ namespace QuantLib {
         // 6. Solver
         FdmSolverDesc solverDesc = { mesher, boundaries, conditions,
                                      calculator, maturity,
-                                     tGrid_, dampingSteps_ };
+                                     tGrid_, dampingSteps_, pool_ };
 
         const std::unique_ptr<FdmG2Solver> solver =
             std::make_unique<FdmG2Solver>(model_, solverDesc, schemeDesc_);
 
         results_.value = solver->valueAt(0.0, 0.0);
     }
+
+    void FdG2SwaptionEngine::setThreadPool(std::shared_ptr<ThreadPool> pool) {
+        pool_ = std::move(pool);
+    }
 }
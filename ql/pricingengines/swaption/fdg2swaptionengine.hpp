@@ -31,6 +31,8 @@
 
 namespace QuantLib {
 
+    class ThreadPool;
+
     class FdG2SwaptionEngine
         : public GenericModelEngine<G2,Swaption::arguments,Swaption::results> {
       public:
@@ -42,10 +44,15 @@ namespace QuantLib {
 
         void calculate() const;
 
+        //! solves the grid lines of the operator in parallel
+        /*! see FdmLinearOpComposite::setThreadPool */
+        void setThreadPool(std::shared_ptr<ThreadPool> pool);
+
       private:
         const Size tGrid_, xGrid_, yGrid_, dampingSteps_;
         const Real invEps_;
         const FdmSchemeDesc schemeDesc_;
+        std::shared_ptr<ThreadPool> pool_;
     };
 }
 #endif
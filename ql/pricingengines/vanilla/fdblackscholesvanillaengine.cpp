@@ -20,13 +20,18 @@
 */
 
 #include <ql/exercise.hpp>
+#include <ql/instruments/payoffs.hpp>
+#include <ql/math/interpolations/cubicinterpolation.hpp>
 #include <ql/processes/blackscholesprocess.hpp>
+#include <ql/methods/finitedifferences/operators/fdmblackscholesop.hpp>
 #include <ql/methods/finitedifferences/solvers/fdmblackscholessolver.hpp>
 #include <ql/methods/finitedifferences/utilities/fdminnervaluecalculator.hpp>
 #include <ql/methods/finitedifferences/operators/fdmlinearoplayout.hpp>
 #include <ql/methods/finitedifferences/meshers/fdmmeshercomposite.hpp>
 #include <ql/methods/finitedifferences/meshers/fdmblackscholesmesher.hpp>
+#include <ql/methods/finitedifferences/meshers/fdmblackscholesmultistrikemesher.hpp>
 #include <ql/methods/finitedifferences/stepconditions/fdmstepconditioncomposite.hpp>
+#include <ql/methods/finitedifferences/stepconditions/fdmsnapshotcondition.hpp>
 #include <ql/pricingengines/vanilla/fdblackscholesvanillaengine.hpp>
 
 namespace QuantLib {
@@ -47,11 +52,40 @@ namespace QuantLib {
 
     void FdBlackScholesVanillaEngine::calculate() const {
 
+        // cache lookup for precalculated results
+        for (Size i = 0; i < cachedArgs2results_.size(); ++i) {
+            if (cachedArgs2results_[i].first.exercise->type()
+                == arguments_.exercise->type()
+                && cachedArgs2results_[i].first.exercise->dates()
+                   == arguments_.exercise->dates()
+                && cachedArgs2results_[i].first.cashFlow
+                   == arguments_.cashFlow) {
+                std::shared_ptr<PlainVanillaPayoff> p1 =
+                    std::dynamic_pointer_cast<PlainVanillaPayoff>(
+                                                        arguments_.payoff);
+                std::shared_ptr<PlainVanillaPayoff> p2 =
+                    std::dynamic_pointer_cast<PlainVanillaPayoff>(
+                                        cachedArgs2results_[i].first.payoff);
+
+                if (p1 && p1->strike() == p2->strike()
+                    && p1->optionType() == p2->optionType()) {
+                    results_ = cachedArgs2results_[i].second;
+                    return;
+                }
+            }
+        }
+
         // 1. Mesher
         const std::shared_ptr<StrikedTypePayoff> payoff =
             std::dynamic_pointer_cast<StrikedTypePayoff>(arguments_.payoff);
 
         const Time maturity = process_->time(arguments_.exercise->lastDate());
+
+        if (!strikes_.empty()) {
+            calculateMultipleStrikes(payoff, maturity);
+            return;
+        }
+
         const std::shared_ptr<Fdm1dMesher> equityMesher =
             std::make_shared<FdmBlackScholesMesher>(
                     xGrid_, process_, maturity, payoff->strike(), 
@@ -92,4 +126,109 @@ namespace QuantLib {
         results_.gamma = solver->gammaAt(spot);
         results_.theta = solver->thetaAt(spot);
     }
+
+    void FdBlackScholesVanillaEngine::calculateMultipleStrikes(
+            const std::shared_ptr<StrikedTypePayoff>& payoff,
+            Time maturity) const {
+
+        // 1. Mesher
+        const std::shared_ptr<Fdm1dMesher> equityMesher =
+            std::make_shared<FdmBlackScholesMultiStrikeMesher>(
+                    xGrid_, process_, maturity, strikes_, 0.0001, 1.5,
+                    std::pair<Real, Real>(payoff->strike(), 0.075),
+                    arguments_.cashFlow);
+
+        const std::shared_ptr<FdmMesher> mesher =
+            std::make_shared<FdmMesherComposite>(equityMesher);
+        const std::shared_ptr<FdmLinearOpLayout> layout = mesher->layout();
+
+        // 2. Payoffs, initial values and step conditions; the first
+        //    payoff is the one of the option being priced
+        std::vector<std::shared_ptr<StrikedTypePayoff> > payoffs(1, payoff);
+        for (Real strike : strikes_)
+            payoffs.push_back(std::make_shared<PlainVanillaPayoff>(
+                                              payoff->optionType(), strike));
+
+        std::vector<Array> values(payoffs.size(), Array(layout->size()));
+        std::vector<std::shared_ptr<FdmSnapshotCondition> > thetaConditions;
+        std::vector<std::shared_ptr<FdmStepConditionComposite> > conditions;
+        for (Size i = 0; i < payoffs.size(); ++i) {
+            const std::shared_ptr<FdmInnerValueCalculator> calculator =
+                std::make_shared<FdmLogInnerValue>(payoffs[i], mesher, 0);
+
+            const std::shared_ptr<FdmStepConditionComposite> condition =
+                FdmStepConditionComposite::vanillaComposite(
+                                    arguments_.cashFlow, arguments_.exercise,
+                                    mesher, calculator,
+                                    process_->riskFreeRate()->referenceDate(),
+                                    process_->riskFreeRate()->dayCounter());
+
+            thetaConditions.push_back(std::make_shared<FdmSnapshotCondition>(
+                0.99*std::min(1.0/365.0,
+                              condition->stoppingTimes().empty()
+                                  ? maturity
+                                  : condition->stoppingTimes().front())));
+            conditions.push_back(FdmStepConditionComposite::joinConditions(
+                                          thetaConditions.back(), condition));
+
+            const FdmLinearOpIterator endIter = layout->end();
+            for (FdmLinearOpIterator iter = layout->begin(); iter != endIter;
+                 ++iter) {
+                values[i][iter.index()] =
+                    calculator->avgInnerValue(iter, maturity);
+            }
+        }
+
+        // 3. Solver, rolling back all payoffs in a single sweep
+        const std::shared_ptr<FdmBlackScholesOp> op =
+            std::make_shared<FdmBlackScholesOp>(
+                             mesher, process_, payoff->strike(),
+                             localVol_, illegalLocalVolOverwrite_);
+
+        FdmBackwardSolver(op, FdmBoundaryConditionSet(),
+                          std::shared_ptr<FdmStepConditionComposite>(),
+                          schemeDesc_)
+            .rollback(values, conditions, maturity, 0.0,
+                      tGrid_, dampingSteps_);
+
+        // 4. Results
+        const Array x = mesher->locations(0);
+        const Real spot = process_->x0();
+        const Real logSpot = std::log(spot);
+
+        cachedArgs2results_.resize(strikes_.size());
+        for (Size i = 0; i < payoffs.size(); ++i) {
+            DividendVanillaOption::results& results =
+                (i == 0) ? results_ : cachedArgs2results_[i-1].second;
+
+            const MonotonicCubicNaturalSpline interpolation(
+                x.begin(), x.end(), values[i].begin());
+            const Array& thetaValues = thetaConditions[i]->getValues();
+
+            results.value = interpolation(logSpot);
+            results.delta = interpolation.derivative(logSpot)/spot;
+            results.gamma = (interpolation.secondDerivative(logSpot)
+                             - interpolation.derivative(logSpot))/(spot*spot);
+            results.theta = (MonotonicCubicNaturalSpline(
+                                 x.begin(), x.end(), thetaValues.begin())(logSpot)
+                             - results.value)/thetaConditions[i]->getTime();
+
+            if (i > 0) {
+                cachedArgs2results_[i-1].first.exercise = arguments_.exercise;
+                cachedArgs2results_[i-1].first.cashFlow = arguments_.cashFlow;
+                cachedArgs2results_[i-1].first.payoff = payoffs[i];
+            }
+        }
+    }
+
+    void FdBlackScholesVanillaEngine::update() {
+        cachedArgs2results_.clear();
+        DividendVanillaOption::engine::update();
+    }
+
+    void FdBlackScholesVanillaEngine::enableMultipleStrikesCaching(
+            const std::vector<Real>& strikes) {
+        strikes_ = strikes;
+        cachedArgs2results_.clear();
+    }
 }
@@ -54,12 +54,37 @@ namespace QuantLib {
 
         void calculate() const;
 
+        // multiple strikes caching engine
+        void update();
+        /*! Options on the given strikes are priced together with the
+            first option passed to the engine, rolling back all their
+            payoffs on a common mesher in a single backward sweep; the
+            results for the other strikes are then returned from the
+            cache as long as the exercise is unchanged.
+
+            \warning the operator uses the volatility at the strike of
+                     the option triggering the calculation; the cached
+                     results are therefore only meaningful for
+                     volatilities not depending on the strike, or
+                     together with local volatility.
+        */
+        void enableMultipleStrikesCaching(const std::vector<Real>& strikes);
+
       private:
+        void calculateMultipleStrikes(
+            const std::shared_ptr<StrikedTypePayoff>& payoff,
+            Time maturity) const;
+
         const std::shared_ptr<GeneralizedBlackScholesProcess> process_;
         const Size tGrid_, xGrid_, dampingSteps_;
         const FdmSchemeDesc schemeDesc_;
         const bool localVol_;
         const Real illegalLocalVolOverwrite_;
+
+        std::vector<Real> strikes_;
+        mutable std::vector<std::pair<DividendVanillaOption::arguments,
+                                      DividendVanillaOption::results> >
+                                                            cachedArgs2results_;
     };
 }
 
@@ -147,7 +147,7 @@ namespace QuantLib {
         // 6. Solver
         const FdmSolverDesc solverDesc = { mesher, boundaries, conditions,
                                            calculator, maturity,
-                                           tGrid_, dampingSteps_ };
+                                           tGrid_, dampingSteps_, pool_ };
 
         const std::shared_ptr<FdmHestonHullWhiteSolver> solver =
             std::make_shared<FdmHestonHullWhiteSolver>(Handle<HestonProcess>(hestonProcess),
@@ -220,4 +220,8 @@ namespace QuantLib {
         strikes_ = strikes;
         update();
     }
+    void FdHestonHullWhiteVanillaEngine::setThreadPool(
+                                        std::shared_ptr<ThreadPool> pool) {
+        pool_ = std::move(pool);
+    }
 }
@@ -33,6 +33,8 @@
 
 namespace QuantLib {
 
+    class ThreadPool;
+
     //! Finite-Differences Heston Hull-White Vanilla Option engine
 
     /*! \ingroup vanillaengines
@@ -62,6 +64,10 @@ namespace QuantLib {
         // multiple strikes caching engine
         void update();
         void enableMultipleStrikesCaching(const std::vector<Real>& strikes);
+
+        //! solves the grid lines of the operator in parallel
+        /*! see FdmLinearOpComposite::setThreadPool */
+        void setThreadPool(std::shared_ptr<ThreadPool> pool);
         
       private:
         const std::shared_ptr<HullWhiteProcess> hwProcess_;
@@ -72,6 +78,7 @@ namespace QuantLib {
         const bool controlVariate_;
         
         std::vector<Real> strikes_;
+        std::shared_ptr<ThreadPool> pool_;
         mutable std::vector<std::pair<DividendVanillaOption::arguments,
                                       DividendVanillaOption::results> >
                                                             cachedArgs2results_;
@@ -65,7 +65,8 @@ namespace QuantLib {
              LsmBasisSystem::PolynomType polynomType,
              Size nCalibrationSamples = Null<Size>(),
              std::optional<bool> antitheticVariateCalibration = std::nullopt,
-             BigNatural seedCalibration = Null<Size>());
+             BigNatural seedCalibration = Null<Size>(),
+             bool streamingCalibration = false);
 
         void calculate() const;
         
@@ -80,6 +81,7 @@ namespace QuantLib {
       private:
         const Size polynomOrder_;
         const LsmBasisSystem::PolynomType polynomType_;
+        const bool streamingCalibration_;
     };
 
     class AmericanPathPricer : public EarlyExercisePathPricer<Path>  {
@@ -123,6 +125,7 @@ namespace QuantLib {
         MakeMCAmericanEngine& withCalibrationSamples(Size calibrationSamples);
         MakeMCAmericanEngine& withAntitheticVariateCalibration(bool b = true);
         MakeMCAmericanEngine& withSeedCalibration(BigNatural seed);
+        MakeMCAmericanEngine& withStreamingCalibration(bool b = true);
 
         // conversion to pricing engine
         operator std::shared_ptr<PricingEngine>() const;
@@ -137,6 +140,7 @@ namespace QuantLib {
         LsmBasisSystem::PolynomType polynomType_;
         std::optional<bool> antitheticCalibration_;
         BigNatural seedCalibration_;
+        bool streamingCalibration_;
     };
 
     template <class RNG, class S, class RNG_Calibration>
@@ -147,14 +151,15 @@ namespace QuantLib {
         Size maxSamples, BigNatural seed, Size polynomOrder,
         LsmBasisSystem::PolynomType polynomType, Size nCalibrationSamples,
         std::optional<bool> antitheticVariateCalibration,
-        BigNatural seedCalibration)
+        BigNatural seedCalibration, bool streamingCalibration)
         : MCLongstaffSchwartzEngine<VanillaOption::engine, SingleVariate, RNG,
                                     S, RNG_Calibration>(
               process, timeSteps, timeStepsPerYear, false, antitheticVariate,
               controlVariate, requiredSamples, requiredTolerance, maxSamples,
               seed, nCalibrationSamples, false, antitheticVariateCalibration,
               seedCalibration),
-          polynomOrder_(polynomOrder), polynomType_(polynomType) {}
+          polynomOrder_(polynomOrder), polynomType_(polynomType),
+          streamingCalibration_(streamingCalibration) {}
 
     template <class RNG, class S, class RNG_Calibration>
     inline void MCAmericanEngine<RNG, S, RNG_Calibration>::calculate() const {
@@ -189,7 +194,8 @@ namespace QuantLib {
         return std::make_shared<LongstaffSchwartzPathPricer<Path>>(
                                       this->timeGrid(),
                                       earlyExercisePathPricer,
-                                      *(process->riskFreeRate()));
+                                      *(process->riskFreeRate()),
+                                      streamingCalibration_);
     }
 
     template <class RNG, class S, class RNG_Calibration>
@@ -254,7 +260,8 @@ namespace QuantLib {
           samples_(Null<Size>()), maxSamples_(Null<Size>()),
           calibrationSamples_(2048), tolerance_(Null<Real>()), seed_(0),
           polynomOrder_(2), polynomType_(LsmBasisSystem::Monomial),
-          antitheticCalibration_(std::nullopt), seedCalibration_(Null<Size>()) {}
+          antitheticCalibration_(std::nullopt), seedCalibration_(Null<Size>()),
+          streamingCalibration_(false) {}
 
     template <class RNG, class S, class RNG_Calibration>
     inline MakeMCAmericanEngine<RNG, S, RNG_Calibration> &
@@ -362,6 +369,14 @@ namespace QuantLib {
         return *this;
     }
 
+    template <class RNG, class S, class RNG_Calibration>
+    inline MakeMCAmericanEngine<RNG, S, RNG_Calibration> &
+    MakeMCAmericanEngine<RNG, S, RNG_Calibration>::withStreamingCalibration(
+        bool b) {
+        streamingCalibration_ = b;
+        return *this;
+    }
+
     template <class RNG, class S, class RNG_Calibration>
     inline MakeMCAmericanEngine<RNG, S, RNG_Calibration>::
     operator std::shared_ptr<PricingEngine>() const {
@@ -381,7 +396,8 @@ namespace QuantLib {
                                      polynomType_,
                                      calibrationSamples_,
                                      antitheticCalibration_,
-                                     seedCalibration_);
+                                     seedCalibration_,
+                                     streamingCalibration_);
     }
 
 }
@@ -60,7 +60,9 @@ namespace QuantLib {
              Size requiredSamples,
              Real requiredTolerance,
              Size maxSamples,
-             BigNatural seed);
+             BigNatural seed,
+             Size threads = 1,
+             Size batchSize = 0);
       protected:
         std::shared_ptr<path_pricer_type> pathPricer() const;
     };
@@ -80,6 +82,8 @@ namespace QuantLib {
         MakeMCEuropeanEngine& withMaxSamples(Size samples);
         MakeMCEuropeanEngine& withSeed(BigNatural seed);
         MakeMCEuropeanEngine& withAntitheticVariate(bool b = true);
+        MakeMCEuropeanEngine& withThreads(Size threads);
+        MakeMCEuropeanEngine& withBatchSize(Size paths);
         // conversion to pricing engine
         operator std::shared_ptr<PricingEngine>() const;
       private:
@@ -89,14 +93,17 @@ namespace QuantLib {
         Real tolerance_;
         bool brownianBridge_;
         BigNatural seed_;
+        Size threads_, batchSize_;
     };
 
-    class EuropeanPathPricer : public PathPricer<Path> {
+    class EuropeanPathPricer : public PathPricer<Path>,
+                               public BatchPathPricer {
       public:
         EuropeanPathPricer(Option::Type type,
                            Real strike,
                            DiscountFactor discount);
         Real operator()(const Path& path) const;
+        void operator()(const PathBatch& paths, Real* values) const;
       private:
         PlainVanillaPayoff payoff_;
         DiscountFactor discount_;
@@ -116,7 +123,9 @@ namespace QuantLib {
              Size requiredSamples,
              Real requiredTolerance,
              Size maxSamples,
-             BigNatural seed)
+             BigNatural seed,
+             Size threads,
+             Size batchSize)
     : MCVanillaEngine<SingleVariate,RNG,S>(process,
                                            timeSteps,
                                            timeStepsPerYear,
@@ -126,7 +135,9 @@ namespace QuantLib {
                                            requiredSamples,
                                            requiredTolerance,
                                            maxSamples,
-                                           seed) {}
+                                           seed,
+                                           threads,
+                                           batchSize) {}
 
 
     template <class RNG, class S>
@@ -157,7 +168,8 @@ namespace QuantLib {
     : process_(process), antithetic_(false),
       steps_(Null<Size>()), stepsPerYear_(Null<Size>()),
       samples_(Null<Size>()), maxSamples_(Null<Size>()),
-      tolerance_(Null<Real>()), brownianBridge_(false), seed_(0) {}
+      tolerance_(Null<Real>()), brownianBridge_(false), seed_(0),
+      threads_(1), batchSize_(0) {}
 
     template <class RNG, class S>
     inline MakeMCEuropeanEngine<RNG,S>&
@@ -222,6 +234,20 @@ namespace QuantLib {
         return *this;
     }
 
+    template <class RNG, class S>
+    inline MakeMCEuropeanEngine<RNG,S>&
+    MakeMCEuropeanEngine<RNG,S>::withThreads(Size threads) {
+        threads_ = threads;
+        return *this;
+    }
+
+    template <class RNG, class S>
+    inline MakeMCEuropeanEngine<RNG,S>&
+    MakeMCEuropeanEngine<RNG,S>::withBatchSize(Size paths) {
+        batchSize_ = paths;
+        return *this;
+    }
+
     template <class RNG, class S>
     inline
     MakeMCEuropeanEngine<RNG,S>::operator std::shared_ptr<PricingEngine>()
@@ -237,7 +263,9 @@ namespace QuantLib {
                                     antithetic_,
                                     samples_, tolerance_,
                                     maxSamples_,
-                                    seed_);
+                                    seed_,
+                                    threads_,
+                                    batchSize_);
     }
 
 
@@ -255,6 +283,14 @@ namespace QuantLib {
         return payoff_(path.back()) * discount_;
     }
 
+    inline void EuropeanPathPricer::operator()(const PathBatch& paths,
+                                               Real* values) const {
+        QL_REQUIRE(paths.length() > 0, "the paths cannot be empty");
+        const Real* last = paths.values(paths.length()-1);
+        for (Size j=0; j<paths.size(); ++j)
+            values[j] = payoff_(last[j]) * discount_;
+    }
+
 }
 
 
@@ -55,6 +55,9 @@ namespace QuantLib {
             stats_type;
         typedef typename McSimulation<MC,RNG,S>::result_type
             result_type;
+        typedef
+        typename McSimulation<MC,RNG,S>::batch_path_generator_type
+            batch_path_generator_type;
         // constructor
         MCVanillaEngine(const std::shared_ptr<StochasticProcess>&,
                         Size timeSteps,
@@ -65,7 +68,9 @@ namespace QuantLib {
                         Size requiredSamples,
                         Real requiredTolerance,
                         Size maxSamples,
-                        BigNatural seed);
+                        BigNatural seed,
+                        Size threads = 1,
+                        Size batchSize = 0);
         // McSimulation implementation
         TimeGrid timeGrid() const;
         std::shared_ptr<path_generator_type> pathGenerator() const {
@@ -77,6 +82,26 @@ namespace QuantLib {
             return std::make_shared<path_generator_type>(process_, grid,
                                            generator, brownianBridge_);
         }
+        std::shared_ptr<path_generator_type>
+        streamPathGenerator(Size stream, Size firstSample) const {
+
+            Size dimensions = process_->factors();
+            TimeGrid grid = this->timeGrid();
+            typename RNG::rsg_type generator =
+                RNG::make_sequence_generator(dimensions*(grid.size()-1),seed_,
+                                             stream, firstSample);
+            return std::make_shared<path_generator_type>(process_, grid,
+                                           generator, brownianBridge_);
+        }
+        std::shared_ptr<batch_path_generator_type>
+        batchPathGenerator() const {
+
+            TimeGrid grid = this->timeGrid();
+            typename RNG::rsg_type generator =
+                RNG::make_sequence_generator(grid.size()-1,seed_);
+            return std::make_shared<batch_path_generator_type>(
+                               process_, grid, generator, brownianBridge_);
+        }
         result_type controlVariateValue() const;
         // data members
         std::shared_ptr<StochasticProcess> process_;
@@ -101,8 +126,11 @@ namespace QuantLib {
                           Size requiredSamples,
                           Real requiredTolerance,
                           Size maxSamples,
-                          BigNatural seed)
-    : McSimulation<MC,RNG,S>(antitheticVariate, controlVariate),
+                          BigNatural seed,
+                          Size threads,
+                          Size batchSize)
+    : McSimulation<MC,RNG,S>(antitheticVariate, controlVariate, threads,
+                             batchSize),
       process_(process), timeSteps_(timeSteps),
       timeStepsPerYear_(timeStepsPerYear),
       requiredSamples_(requiredSamples), maxSamples_(maxSamples),
@@ -128,6 +128,31 @@ namespace QuantLib {
                                  stdDeviation(t0, x0, dt) * dw);
     }
 
+    void GeneralizedBlackScholesProcess::evolveBatch(Time t0, Time dt,
+                                                     Size n,
+                                                     const Real* x0,
+                                                     const Real* dw,
+                                                     Real* x1) const {
+        localVolatility(); // trigger update
+        if (isStrikeIndependent_ && !forceDiscretization_) {
+            // exact value for curves; drift and variance don't
+            // depend on the state and are the same for all values
+            Real var = variance(t0, x0_->value(), dt);
+            Real drift = (riskFreeRate_->forwardRate(t0, t0 + dt, Continuous,
+                                                     NoFrequency, true) -
+                          dividendYield_->forwardRate(t0, t0 + dt, Continuous,
+                                                      NoFrequency, true)) *
+                             dt -
+                         0.5 * var;
+            Real stdDev = std::sqrt(var);
+            for (Size i=0; i<n; ++i)
+                x1[i] = GeneralizedBlackScholesProcess::apply(
+                                                x0[i], stdDev * dw[i] + drift);
+        } else {
+            StochasticProcess1D::evolveBatch(t0, dt, n, x0, dw, x1);
+        }
+    }
+
     Time GeneralizedBlackScholesProcess::time(const Date& d) const {
         return riskFreeRate_->dayCounter().yearFraction(
                                            riskFreeRate_->referenceDate(), d);
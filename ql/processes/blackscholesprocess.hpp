@@ -77,6 +77,13 @@ namespace QuantLib {
         Real stdDeviation(Time t0, Real x0, Time dt) const;
         Real variance(Time t0, Real x0, Time dt) const;
         Real evolve(Time t0, Real x0, Time dt, Real dw) const;
+        /*! \warning the exact kernel used for strike-independent
+                     volatilities replicates the evolve() method of
+                     this class; derived classes overriding evolve()
+                     must override this method as well.
+        */
+        void evolveBatch(Time t0, Time dt, Size n,
+                         const Real* x0, const Real* dw, Real* x1) const;
         //@}
         Time time(const Date&) const;
         //! \name Observer interface
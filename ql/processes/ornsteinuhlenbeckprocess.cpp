@@ -41,5 +41,14 @@ namespace QuantLib {
         }
     }
 
-}
+    void OrnsteinUhlenbeckProcess::evolveBatch(Time t0, Time dt, Size n,
+                                               const Real* x0,
+                                               const Real* dw,
+                                               Real* x1) const {
+        Real decay = std::exp(-speed_*dt);
+        Real sigma = stdDeviation(t0, level_, dt);
+        for (Size i=0; i<n; ++i)
+            x1[i] = (level_ + (x0[i] - level_) * decay) + sigma * dw[i];
+    }
 
+}
@@ -56,6 +56,8 @@ namespace QuantLib {
         Real stdDeviation(Time t0,
                           Real x0,
                           Time dt) const;
+        void evolveBatch(Time t0, Time dt, Size n,
+                         const Real* x0, const Real* dw, Real* x1) const;
         //@}
         Real x0() const;
         Real speed() const;
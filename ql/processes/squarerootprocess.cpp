@@ -41,4 +41,19 @@ namespace QuantLib {
         return volatility_*std::sqrt(x);
     }
 
+    void SquareRootProcess::evolveBatch(Time t0, Time dt, Size n,
+                                        const Real* x0, const Real* dw,
+                                        Real* x1) const {
+        if (!std::dynamic_pointer_cast<EulerDiscretization>(
+                                                         discretization_)) {
+            StochasticProcess1D::evolveBatch(t0, dt, n, x0, dw, x1);
+            return;
+        }
+        // same operations as the Euler scheme in evolve()
+        Real sqrtDt = std::sqrt(dt);
+        for (Size i=0; i<n; ++i)
+            x1[i] = (x0[i] + speed_*(mean_ - x0[i])*dt)
+                  + volatility_*std::sqrt(x0[i])*sqrtDt*dw[i];
+    }
+
 }
@@ -50,6 +50,8 @@ namespace QuantLib {
         Real x0() const;
         Real drift(Time t, Real x) const;
         Real diffusion(Time t, Real x) const;
+        void evolveBatch(Time t0, Time dt, Size n,
+                         const Real* x0, const Real* dw, Real* x1) const;
         //@}
 
         Real a() const { return speed_;  }
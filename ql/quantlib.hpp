@@ -10,6 +10,7 @@
 #include <ql/default.hpp>
 #include <ql/discretizedasset.hpp>
 #include <ql/errors.hpp>
+#include <ql/evaluationcontext.hpp>
 #include <ql/exchangerate.hpp>
 #include <ql/exercise.hpp>
 #include <ql/event.hpp>
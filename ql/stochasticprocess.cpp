@@ -102,4 +102,11 @@ namespace QuantLib {
         return x0 + dx;
     }
 
+    void StochasticProcess1D::evolveBatch(Time t0, Time dt, Size n,
+                                          const Real* x0, const Real* dw,
+                                          Real* x1) const {
+        for (Size i=0; i<n; ++i)
+            x1[i] = evolve(t0, x0[i], dt, dw[i]);
+    }
+
 }
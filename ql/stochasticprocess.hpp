@@ -220,6 +220,16 @@ namespace QuantLib {
             returns \f$ x + \Delta x \f$.
         */
         virtual Real apply(Real x0, Real dx) const;
+        /*! evolves \p n values of the state variable over the same
+            time interval, writing the results into \p x1 (which can
+            coincide with \p x0).  By default, it calls evolve() on
+            each value; processes can override it with a kernel
+            working on the whole range at once, e.g., in order to
+            simulate a batch of paths.
+        */
+        virtual void evolveBatch(Time t0, Time dt, Size n,
+                                 const Real* x0, const Real* dw,
+                                 Real* x1) const;
         //@}
       protected:
         StochasticProcess1D();
@@ -30,40 +30,106 @@
 #include <ql/termstructures/bootstraphelper.hpp>
 #include <ql/termstructures/bootstraperror.hpp>
 #include <ql/math/interpolations/linearinterpolation.hpp>
+#include <ql/math/matrix.hpp>
 #include <ql/math/solvers1d/finitedifferencenewtonsafe.hpp>
 #include <ql/math/solvers1d/brent.hpp>
 #include <ql/utilities/dataformatters.hpp>
 
 namespace QuantLib {
 
+    namespace detail {
+
+        // raised when the given helper sends a notification
+        class BootstrapHelperFlag : public Observer {
+          public:
+            explicit BootstrapHelperFlag(
+                                const std::shared_ptr<Observable>& helper)
+            : helper_(helper.get()), raised_(false) {
+                registerWith(helper);
+            }
+            void update() { raised_ = true; }
+            const Observable* helper() const { return helper_; }
+            bool isRaised() const { return raised_; }
+            void lower() { raised_ = false; }
+          private:
+            const Observable* helper_;
+            bool raised_;
+        };
+
+    }
+
     //! Universal piecewise-term-structure bootsrapper.
+    /*! In incremental mode, the bootstrapper keeps track of the
+        helpers that sent a notification since the last calculation
+        and, when possible, only solves for the pillar of the first of
+        them and those after it; earlier pillar values and the
+        interpolation are kept.  This requires a local interpolation
+        and pillars coinciding with the latest relevant dates of the
+        helpers, so that a pillar value only depends on the previous
+        ones; otherwise, as well as when the pillar dates move, no
+        helper changed (e.g., because of a change in the jumps) or
+        the incremental bootstrap fails, the whole curve is
+        bootstrapped as usual.
+
+        When required, the bootstrapper also calculates the Jacobian
+        of the pillar values with respect to the helper quotes.  At
+        the solution, each helper's implied quote equals its market
+        quote; by the implicit-function theorem, the Jacobian is the
+        inverse of the matrix of derivatives of the implied quotes
+        with respect to the pillar values.  The latter are obtained
+        by bumping the pillars of the bootstrapped curve, which only
+        requires repricing the helpers instead of bootstrapping the
+        curve again for each bumped quote.
+    */
     template <class Curve>
     class IterativeBootstrap {
         typedef typename Curve::traits_type Traits;
         typedef typename Curve::interpolator_type Interpolator;
       public:
-        IterativeBootstrap();
+        explicit IterativeBootstrap(bool incremental = false,
+                                    bool jacobian = false);
         void setup(Curve* ts);
         void calculate() const;
+        /*! derivatives of the curve data (rows) with respect to the
+            helper quotes (columns, in the order in which the helpers
+            were passed to the curve; expired helpers have null
+            columns.)  It is only available if required on
+            construction and after the curve was bootstrapped.
+        */
+        const Matrix& jacobian() const;
       private:
         void initialize() const;
+        Size firstChangedPillar() const;
+        void calculateJacobian() const;
         Curve* ts_;
         Size n_;
         Brent firstSolver_;
         FiniteDifferenceNewtonSafe solver_;
+        bool incremental_, requireJacobian_;
         mutable bool initialized_, validCurve_, loopRequired_;
         mutable Size firstAliveHelper_, alive_;
         mutable std::vector<Real> previousData_;
         mutable std::vector<std::shared_ptr<BootstrapError<Curve> > > errors_;
+        // incremental mode: one flag per helper, in the same order as
+        // the sorted helpers, and the pillars of the last bootstrap
+        mutable std::vector<std::shared_ptr<detail::BootstrapHelperFlag> >
+                                                                     flags_;
+        mutable std::vector<Date> bootstrappedDates_;
+        // Jacobian and helpers in their original order
+        mutable Matrix jacobian_;
+        std::vector<std::shared_ptr<typename Curve::traits_type::helper> >
+                                                                   helpers_;
     };
 
 
     // template definitions
 
     template <class Curve>
-    IterativeBootstrap<Curve>::IterativeBootstrap()
-        : ts_(0), initialized_(false), validCurve_(false), 
-          loopRequired_(Interpolator::global) {}
+    IterativeBootstrap<Curve>::IterativeBootstrap(bool incremental,
+                                                  bool jacobian)
+        : ts_(0), incremental_(incremental), requireJacobian_(jacobian),
+          initialized_(false),
+          validCurve_(false), loopRequired_(Interpolator::global) {}
 
     template <class Curve>
     void IterativeBootstrap<Curve>::setup(Curve* ts) {
@@ -73,6 +139,10 @@ namespace QuantLib {
         QL_REQUIRE(n_ > 0, "no bootstrap helpers given")
         for (Size j=0; j<n_; ++j)
             ts_->registerWith(ts_->instruments_[j]);
+        flags_.clear();
+        bootstrappedDates_.clear();
+        helpers_ = ts_->instruments_;
+        jacobian_ = Matrix();
 
         // do not initialize yet: instruments could be invalid here
         // but valid later when bootstrapping is actually required
@@ -83,6 +153,18 @@ namespace QuantLib {
         // ensure helpers are sorted
         std::sort(ts_->instruments_.begin(), ts_->instruments_.end(),
                   detail::BootstrapHelperSorter());
+        if (incremental_) {
+            bool aligned = (flags_.size() == n_);
+            for (Size j=0; j<n_ && aligned; ++j)
+                aligned = (flags_[j]->helper() == ts_->instruments_[j].get());
+            if (!aligned) {
+                flags_.resize(n_);
+                for (Size j=0; j<n_; ++j)
+                    flags_[j] = std::make_shared<detail::BootstrapHelperFlag>(
+                                                       ts_->instruments_[j]);
+                bootstrappedDates_.clear();
+            }
+        }
         // skip expired helpers
         Date firstDate = Traits::initialDate(ts_);
         QL_REQUIRE(ts_->instruments_[n_-1]->pillarDate()>firstDate,
@@ -183,10 +265,13 @@ namespace QuantLib {
         // there might be a valid curve state to use as guess
         bool validData = validCurve_;
 
+        // in incremental mode, earlier pillars might be kept
+        Size firstPillar = firstChangedPillar();
+
         for (Size iteration=0; ; ++iteration) {
             previousData_ = ts_->data_;
 
-            for (Size i=1; i<=alive_; ++i) { // pillar loop
+            for (Size i=firstPillar; i<=alive_; ++i) { // pillar loop
 
                 // bracket root and calculate guess
                 Real min = Traits::minValueAfter(i, ts_, validData,
@@ -225,6 +310,13 @@ namespace QuantLib {
                     else
                         firstSolver_.solve(*errors_[i], accuracy,guess,min,max);
                 } catch (std::exception &e) {
+                    // the kept pillars might not suit the new quotes;
+                    // bootstrap the whole curve instead
+                    if (firstPillar > 1) {
+                        firstPillar = 1;
+                        i = 0;
+                        continue;
+                    }
                     // the previous curve state could have been a bad guess
                     // let's restart without using it
                     if (validCurve_) {
@@ -258,6 +350,97 @@ namespace QuantLib {
             validData = true;
         }
         validCurve_ = true;
+
+        if (incremental_) {
+            // notifications sent while bootstrapping (e.g., when the
+            // helpers were linked to the curve) are not changes
+            for (Size j=0; j<n_; ++j)
+                flags_[j]->lower();
+            bootstrappedDates_ = ts_->dates_;
+        }
+
+        if (requireJacobian_)
+            calculateJacobian();
+    }
+
+    template <class Curve>
+    const Matrix& IterativeBootstrap<Curve>::jacobian() const {
+        QL_REQUIRE(requireJacobian_,
+                   "Jacobian not required on bootstrapper construction");
+        QL_REQUIRE(!jacobian_.empty(), "curve not bootstrapped yet");
+        return jacobian_;
+    }
+
+    template <class Curve>
+    void IterativeBootstrap<Curve>::calculateJacobian() const {
+        std::vector<Real>& data = ts_->data_;
+
+        // derivatives of the implied quotes (rows) with respect to the
+        // pillar values (columns) by central differences
+        Matrix derivatives(alive_, alive_, 0.0);
+        Real firstPointDependency = 0.0;
+        for (Size k=1; k<=alive_; ++k) {
+            Real value = data[k], firstValue = data[0];
+            Real h = 1.0e-6 * std::max(std::fabs(value), 1.0);
+            // with a local interpolation and no loop, a helper only
+            // depends on its pillar and the previous ones
+            Size firstRow = loopRequired_ ? 1 : k;
+
+            Traits::updateGuess(data, value+h, k);
+            ts_->interpolation_.update();
+            Real firstValueUp = data[0];
+            for (Size i=firstRow; i<=alive_; ++i)
+                derivatives[i-1][k-1] =
+                    ts_->instruments_[firstAliveHelper_+i-1]->impliedQuote();
+
+            Traits::updateGuess(data, value-h, k);
+            ts_->interpolation_.update();
+            Real firstValueDown = data[0];
+            for (Size i=firstRow; i<=alive_; ++i)
+                derivatives[i-1][k-1] = (derivatives[i-1][k-1] -
+                    ts_->instruments_[firstAliveHelper_+i-1]->impliedQuote())
+                    / (2.0*h);
+
+            // some traits also move the first point with the first pillar
+            if (k == 1)
+                firstPointDependency =
+                    (firstValueUp - firstValueDown) / (2.0*h);
+
+            data[k] = value;
+            data[0] = firstValue;
+            ts_->interpolation_.update();
+        }
+
+        // the implied quotes equal the market quotes at the solution
+        Matrix inverseDerivatives = inverse(derivatives);
+
+        jacobian_ = Matrix(alive_+1, n_, 0.0);
+        for (Size i=1; i<=alive_; ++i) {
+            const std::shared_ptr<typename Traits::helper>& helper =
+                ts_->instruments_[firstAliveHelper_+i-1];
+            Size column =
+                std::find(helpers_.begin(), helpers_.end(), helper)
+                - helpers_.begin();
+            for (Size k=1; k<=alive_; ++k)
+                jacobian_[k][column] = inverseDerivatives[k-1][i-1];
+            jacobian_[0][column] =
+                firstPointDependency * jacobian_[1][column];
+            // leave the helper consistent with the unbumped curve
+            helper->impliedQuote();
+        }
+    }
+
+    template <class Curve>
+    Size IterativeBootstrap<Curve>::firstChangedPillar() const {
+        if (!incremental_ || !validCurve_ || loopRequired_ ||
+            Interpolator::global || ts_->dates_ != bootstrappedDates_)
+            return 1;
+        for (Size j=firstAliveHelper_; j<n_; ++j) {
+            if (flags_[j]->isRaised())
+                return j-firstAliveHelper_+1;
+        }
+        // the notification didn't come from the helpers
+        return 1;
     }
 
 }
@@ -67,6 +67,7 @@ namespace QuantLib {
       public:
         typedef Traits traits_type;
         typedef Interpolator interpolator_type;
+        typedef Bootstrap<this_curve> bootstrap_type;
         //! \name Constructors
         //@{
         PiecewiseYieldCurve(
@@ -169,6 +170,17 @@ namespace QuantLib {
         const std::vector<Real>& data() const;
         std::vector<std::pair<Date, Real> > nodes() const;
         //@}
+        //! \name Sensitivities
+        //@{
+        /*! derivatives of the curve data with respect to the helper
+            quotes, as calculated by the bootstrapper during the last
+            bootstrap; rows correspond to data() and columns to the
+            helpers in the order in which they were passed.  Only
+            available for bootstrappers supporting it (e.g.,
+            IterativeBootstrap built with <tt>jacobian = true</tt>).
+        */
+        const Matrix& jacobian() const;
+        //@}
         //! \name Observer interface
         //@{
         void update();
@@ -229,6 +241,12 @@ namespace QuantLib {
         return base_curve::nodes();
     }
 
+    template <class C, class I, template <class> class B>
+    inline const Matrix& PiecewiseYieldCurve<C,I,B>::jacobian() const {
+        calculate();
+        return bootstrap_.jacobian();
+    }
+
     template <class C, class I, template <class> class B>
     inline void PiecewiseYieldCurve<C,I,B>::update() {
 
@@ -9,6 +9,7 @@
 #include <ql/utilities/observablevalue.hpp>
 #include <ql/utilities/steppingiterator.hpp>
 #include <ql/utilities/stringutils.hpp>
+#include <ql/utilities/threadpool.hpp>
 #include <ql/utilities/tracing.hpp>
 #include <ql/utilities/transformiterator.hpp>
 #include <ql/utilities/vectors.hpp>
@@ -0,0 +1,72 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/utilities/threadpool.hpp>
+#include <ql/errors.hpp>
+
+namespace QuantLib {
+
+    ThreadPool::ThreadPool(Size threads)
+    : stopping_(false) {
+        QL_REQUIRE(threads > 0, "at least one thread required");
+        workers_.reserve(threads);
+        for (Size i=0; i<threads; ++i)
+            workers_.emplace_back([this]() { run(); });
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        condition_.notify_all();
+        for (auto& worker : workers_)
+            worker.join();
+    }
+
+    Size ThreadPool::hardwareConcurrency() {
+        Size n = std::thread::hardware_concurrency();
+        return n > 0 ? n : 1;
+    }
+
+    void ThreadPool::enqueue(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            QL_REQUIRE(!stopping_, "thread pool is shutting down");
+            tasks_.push(std::move(task));
+        }
+        condition_.notify_one();
+    }
+
+    void ThreadPool::run() {
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                condition_.wait(lock, [this]() {
+                    return stopping_ || !tasks_.empty();
+                });
+                if (tasks_.empty())
+                    return;
+                task = std::move(tasks_.front());
+                tasks_.pop();
+            }
+            task();
+        }
+    }
+
+}
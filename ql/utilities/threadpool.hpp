@@ -0,0 +1,177 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file threadpool.hpp
+    \brief fixed-size pool of worker threads
+*/
+
+#ifndef quantlib_thread_pool_hpp
+#define quantlib_thread_pool_hpp
+
+#include <ql/errors.hpp>
+#include <ql/evaluationcontext.hpp>
+#include <ql/types.hpp>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace QuantLib {
+
+    //! fixed-size pool of worker threads
+    /*! Tasks are executed in submission order by the first available
+        worker.  The destructor waits for all queued tasks to complete.
+
+        parallelFor() lets the calling thread take part in the work, so
+        that it can be safely called from within a task running on the
+        same pool.
+
+        Tasks run in the EvaluationContext that was current on the
+        thread submitting them.
+    */
+    class ThreadPool {
+      public:
+        //! creates the given number of workers (at least one)
+        explicit ThreadPool(Size threads);
+        ~ThreadPool();
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+        //! number of worker threads
+        Size size() const { return workers_.size(); }
+        //! queues a task and returns a future for its result
+        template <class F>
+        std::future<typename std::invoke_result<F>::type> submit(F f);
+        //! calls f(i) for i in [0,n) and waits for all calls to complete
+        /*! The calls are distributed dynamically among the workers and
+            the calling thread; the first exception thrown by any call,
+            if any, is rethrown after all calls have completed.
+        */
+        template <class F>
+        void parallelFor(Size n, const F& f);
+        //! calls f(begin, end) on contiguous chunks covering [0,n)
+        /*! The chunk boundaries are multiples of \p granularity, so
+            that blocks of that size are never split; there are a few
+            chunks per thread in order to balance the load.  Calls are
+            distributed as in parallelFor().
+        */
+        template <class F>
+        void parallelForChunks(Size n, Size granularity, const F& f);
+        //! number of hardware threads, or 1 if it cannot be determined
+        static Size hardwareConcurrency();
+      private:
+        void enqueue(std::function<void()> task);
+        void run();
+        std::vector<std::thread> workers_;
+        std::queue<std::function<void()> > tasks_;
+        std::mutex mutex_;
+        std::condition_variable condition_;
+        bool stopping_;
+    };
+
+
+    // inline definitions
+
+    template <class F>
+    inline std::future<typename std::invoke_result<F>::type>
+    ThreadPool::submit(F f) {
+        typedef typename std::invoke_result<F>::type result_type;
+        auto task =
+            std::make_shared<std::packaged_task<result_type()> >(std::move(f));
+        std::future<result_type> result = task->get_future();
+        const Integer context = EvaluationContext::current();
+        enqueue([task, context]() {
+            EvaluationContext::Guard guard(context);
+            (*task)();
+        });
+        return result;
+    }
+
+    template <class F>
+    inline void ThreadPool::parallelFor(Size n, const F& f) {
+        if (n == 0)
+            return;
+
+        struct State {
+            std::atomic<Size> next{0};
+            Size done = 0;
+            std::exception_ptr error;
+            std::mutex mutex;
+            std::condition_variable finished;
+        };
+        // helpers queued behind other tasks might start after this
+        // call returned; they find no index left and only touch the
+        // shared state, which they keep alive.
+        std::shared_ptr<State> state = std::make_shared<State>();
+        const Integer context = EvaluationContext::current();
+        auto work = [state, n, context, &f]() {
+            EvaluationContext::Guard guard(context);
+            for (Size i = state->next++; i < n; i = state->next++) {
+                std::exception_ptr error;
+                try {
+                    f(i);
+                } catch (...) {
+                    error = std::current_exception();
+                }
+                std::lock_guard<std::mutex> lock(state->mutex);
+                if (error && !state->error)
+                    state->error = error;
+                if (++state->done == n)
+                    state->finished.notify_all();
+            }
+        };
+
+        Size helpers = std::min(size(), n-1);
+        for (Size i=0; i<helpers; ++i)
+            enqueue(work);
+        work();
+
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->finished.wait(lock, [&state, n]() { return state->done == n; });
+        if (state->error)
+            std::rethrow_exception(state->error);
+    }
+
+    template <class F>
+    inline void ThreadPool::parallelForChunks(Size n, Size granularity,
+                                              const F& f) {
+        QL_REQUIRE(granularity > 0, "null granularity");
+        const Size blocks = (n + granularity - 1)/granularity;
+        const Size chunks = std::min(blocks, 4*(size()+1));
+        if (chunks <= 1) {
+            if (n > 0)
+                f(Size(0), n);
+            return;
+        }
+        parallelFor(chunks, [&](Size c) {
+            const Size begin = (blocks*c/chunks)*granularity;
+            const Size end = std::min((blocks*(c+1)/chunks)*granularity, n);
+            f(begin, end);
+        });
+    }
+
+}
+
+
+#endif
@@ -208,3 +208,30 @@ TEST_CASE("Array_ArrayFunctions", "[Array]") {
 
 }
 
+TEST_CASE("Array_CompoundAssignment", "[Array]") {
+
+    INFO("Testing array compound assignment...");
+
+    Array a(5), b(5);
+    for (Size i=0; i < a.size(); ++i) {
+        a[i] = std::sin(Real(i))+1.1;
+        b[i] = std::cos(Real(i))+1.1;
+    }
+
+    Array sum = a, difference = a, product = a, ratio = a;
+    sum += b;
+    difference -= b;
+    product *= b;
+    ratio /= b;
+
+    for (Size i=0; i < a.size(); ++i) {
+        if (sum[i] != (a+b)[i])
+            FAIL("Array compound assignment test += failed");
+        if (difference[i] != (a-b)[i])
+            FAIL("Array compound assignment test -= failed");
+        if (product[i] != (a*b)[i])
+            FAIL("Array compound assignment test *= failed");
+        if (ratio[i] != (a/b)[i])
+            FAIL("Array compound assignment test /= failed");
+    }
+}
@@ -686,6 +686,67 @@ TEST_CASE("AsianOption_MCDiscreteArithmeticAveragePrice", "[AsianOption]") {
 }
 
 
+TEST_CASE("AsianOption_MCDiscreteArithmeticAveragePriceBatch", "[AsianOption]") {
+
+    INFO("Testing batch simulation of discrete arithmetic average-price Asians...");
+
+    DayCounter dc = Actual360();
+    Date today = Date::todaysDate();
+
+    std::shared_ptr<SimpleQuote> spot = std::make_shared<SimpleQuote>(100.0);
+    std::shared_ptr<YieldTermStructure> qTS = flatRate(today, 0.03, dc);
+    std::shared_ptr<YieldTermStructure> rTS = flatRate(today, 0.06, dc);
+    std::shared_ptr<BlackVolTermStructure> volTS = flatVol(today, 0.20, dc);
+    std::shared_ptr<BlackScholesMertonProcess> stochProcess =
+        std::make_shared<BlackScholesMertonProcess>(
+                                      Handle<Quote>(spot),
+                                      Handle<YieldTermStructure>(qTS),
+                                      Handle<YieldTermStructure>(rTS),
+                                      Handle<BlackVolTermStructure>(volTS));
+
+    std::shared_ptr<StrikedTypePayoff> payoff =
+        std::make_shared<PlainVanillaPayoff>(Option::Call, 100.0);
+
+    // with and without a fixing at the evaluation date
+    for (Integer first : { 0, 30 }) {
+        std::vector<Date> fixingDates(12);
+        for (Size i=0; i<fixingDates.size(); ++i)
+            fixingDates[i] = today + first + Integer(30*i);
+        std::shared_ptr<Exercise> exercise =
+            std::make_shared<EuropeanExercise>(fixingDates.back());
+        DiscreteAveragingAsianOption option(Average::Arithmetic, 0.0, 0,
+                                            fixingDates, payoff, exercise);
+
+        for (bool controlVariate : { false, true }) {
+            option.setPricingEngine(
+                MakeMCDiscreteArithmeticAPEngine<PseudoRandom>(stochProcess)
+                .withSamples(3000)
+                .withAntitheticVariate()
+                .withControlVariate(controlVariate)
+                .withSeed(42));
+            Real expected = option.NPV();
+
+            option.setPricingEngine(
+                MakeMCDiscreteArithmeticAPEngine<PseudoRandom>(stochProcess)
+                .withSamples(3000)
+                .withAntitheticVariate()
+                .withControlVariate(controlVariate)
+                .withSeed(42)
+                .withBatchSize(256));
+            Real calculated = option.NPV();
+
+            if (calculated != expected)
+                FAIL_CHECK("batch simulation differs from path-by-path one:"
+                           << std::setprecision(16)
+                           << "\n    first fixing:    today + " << first
+                           << "\n    control variate: " << controlVariate
+                           << "\n    path by path:    " << expected
+                           << "\n    batch:           " << calculated);
+        }
+    }
+}
+
+
 TEST_CASE("AsianOption_MCDiscreteArithmeticAverageStrike", "[AsianOption]") {
 
     INFO(
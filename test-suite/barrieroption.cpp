@@ -516,6 +516,72 @@ TEST_CASE("BarrierOption_BabsiriValues", "[BarrierOption]") {
     }
 }
 
+TEST_CASE("BarrierOption_MCBatchSimulation", "[BarrierOption]") {
+
+    INFO("Testing batch simulation in the Monte Carlo barrier engine...");
+
+    DayCounter dc = Actual360();
+    Date today = Date::todaysDate();
+
+    std::shared_ptr<SimpleQuote> underlying =
+        std::make_shared<SimpleQuote>(100.0);
+    std::shared_ptr<YieldTermStructure> qTS = flatRate(today, 0.02, dc);
+    std::shared_ptr<YieldTermStructure> rTS = flatRate(today, 0.05, dc);
+    std::shared_ptr<BlackVolTermStructure> volTS = flatVol(today, 0.25, dc);
+    std::shared_ptr<BlackScholesMertonProcess> stochProcess =
+        std::make_shared<BlackScholesMertonProcess>(
+                                      Handle<Quote>(underlying),
+                                      Handle<YieldTermStructure>(qTS),
+                                      Handle<YieldTermStructure>(rTS),
+                                      Handle<BlackVolTermStructure>(volTS));
+
+    std::shared_ptr<StrikedTypePayoff> payoff =
+        std::make_shared<PlainVanillaPayoff>(Option::Call, 100.0);
+    std::shared_ptr<Exercise> exercise =
+        std::make_shared<EuropeanExercise>(today + 360);
+
+    struct {
+        Barrier::Type type;
+        Real barrier;
+    } barriers[] = {
+        { Barrier::DownIn,  90.0 },
+        { Barrier::UpIn,   110.0 },
+        { Barrier::DownOut, 90.0 },
+        { Barrier::UpOut,  120.0 }
+    };
+
+    for (const auto& b : barriers) {
+        BarrierOption option(b.type, b.barrier, 1.0, payoff, exercise);
+        for (bool biased : { false, true }) {
+            option.setPricingEngine(
+                MakeMCBarrierEngine<PseudoRandom>(stochProcess)
+                .withStepsPerYear(50)
+                .withBias(biased)
+                .withSamples(2000)
+                .withSeed(42));
+            Real expected = option.NPV();
+
+            option.setPricingEngine(
+                MakeMCBarrierEngine<PseudoRandom>(stochProcess)
+                .withStepsPerYear(50)
+                .withBias(biased)
+                .withSamples(2000)
+                .withSeed(42)
+                .withBatchSize(300));
+            Real calculated = option.NPV();
+
+            if (calculated != expected)
+                FAIL_CHECK("batch simulation differs from path-by-path one:"
+                           << std::setprecision(16)
+                           << "\n    barrier type: " << b.type
+                           << "\n    biased:       " << biased
+                           << "\n    path by path: " << expected
+                           << "\n    batch:        " << calculated);
+        }
+    }
+}
+
+
 TEST_CASE("BarrierOption_BeagleholeValues", "[BarrierOption]") {
 
     INFO("Testing barrier options against Beaglehole's values...");
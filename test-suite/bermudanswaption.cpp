@@ -30,6 +30,7 @@
 #include <ql/time/daycounters/thirty360.hpp>
 #include <ql/indexes/ibor/euribor.hpp>
 #include <ql/time/schedule.hpp>
+#include <ql/utilities/threadpool.hpp>
 
 using namespace QuantLib;
 
@@ -263,6 +264,12 @@ TEST_CASE("BermudanSwaption_CachedG2Values", "[BermudanSwaption]") {
     const std::shared_ptr<PricingEngine> treeEngine(
         std::make_shared<TreeSwaptionEngine>(g2Model, 50));
 
+    // the G2 solver splits its operator over the threads of the pool;
+    // the results must not change
+    const std::shared_ptr<FdG2SwaptionEngine> multiThreadedFdmEngine(
+        std::make_shared<FdG2SwaptionEngine>(g2Model, 50, 75, 75, 0, 1e-3));
+    multiThreadedFdmEngine->setThreadPool(std::make_shared<ThreadPool>(3));
+
 #if defined(QL_USE_INDEXED_COUPON)
     const Real expectedFdm[] = { 103.231, 54.6519, 20.0475, 5.26941, 1.07097 };
     const Real expectedTree[]= { 103.253, 54.6685, 20.1399, 5.40517, 1.10642 };
@@ -282,6 +289,17 @@ TEST_CASE("BermudanSwaption_CachedG2Values", "[BermudanSwaption]") {
                         << "expected:   " << expectedFdm[i]);
         }
 
+        swaptions[i]->setPricingEngine(multiThreadedFdmEngine);
+        const Real multiThreadedFdm = swaptions[i]->NPV();
+
+        if (multiThreadedFdm != calculatedFdm) {
+            FAIL_CHECK("failed to reproduce G2 FDM swaption value "
+                        "with multiple threads:\n"
+                        << std::setprecision(12)
+                        << "calculated: " << multiThreadedFdm << "\n"
+                        << "expected:   " << calculatedFdm);
+        }
+
         swaptions[i]->setPricingEngine(treeEngine);
         const Real calculatedTree = swaptions[i]->NPV();
 
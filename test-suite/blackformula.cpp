@@ -21,6 +21,7 @@
 
 #include "utilities.hpp"
 #include <ql/pricingengines/blackformula.hpp>
+#include <ql/pricingengines/blackcalculator.hpp>
 
 using namespace QuantLib;
 
@@ -116,3 +117,81 @@ TEST_CASE("BlackFormula_ChambersImpliedVol", "[BlackFormula]") {
     }
 }
 
+TEST_CASE("BlackFormula_Batch", "[BlackFormula]") {
+
+    INFO("Testing batched Black formula against scalar results...");
+
+    Option::Type types[] = {Option::Call, Option::Put};
+    Real strikes[] = {0.0, 10.0, 50.0, 90.0, 100.0, 110.0, 200.0, 1000.0};
+    Real stdDevs[] = {0.0, 1.0e-4, 0.05, 0.2, 0.5, 1.0, 3.0};
+    Real discounts[] = {1.00, 0.95, 0.50};
+    Real forward = 100.0;
+
+    std::vector<Option::Type> optionType;
+    std::vector<Real> strike, fwd, stdDev, discount;
+    for (auto& type : types)
+        for (Real k : strikes)
+            for (Real s : stdDevs)
+                for (Real d : discounts) {
+                    optionType.push_back(type);
+                    strike.push_back(k);
+                    fwd.push_back(forward);
+                    stdDev.push_back(s);
+                    discount.push_back(d);
+                }
+
+    // more options than one internal block
+    const Size m = optionType.size(), n = 4*m;
+    for (Size i=m; i<n; ++i) {
+        optionType.push_back(optionType[i % m]);
+        strike.push_back(strike[i % m]*1.01);
+        fwd.push_back(fwd[i % m]*0.99);
+        stdDev.push_back(stdDev[i % m]);
+        discount.push_back(discount[i % m]);
+    }
+
+    std::vector<Real> value(n), delta(n), gamma(n), vega(n);
+    blackFormulaBatch(n, &optionType[0], &strike[0], &fwd[0], &stdDev[0],
+                      &discount[0], &value[0], &delta[0], &gamma[0], &vega[0]);
+
+    const Real tol = 1.0e-12;
+    for (Size i=0; i<n; ++i) {
+        const Real expected = blackFormula(optionType[i], strike[i], fwd[i],
+                                           stdDev[i], discount[i]);
+        Real expectedDelta, expectedGamma, expectedVega;
+        if (strike[i] == 0.0 || stdDev[i] == 0.0) {
+            const bool itm = optionType[i]*(fwd[i]-strike[i]) > 0.0;
+            expectedDelta = itm ? discount[i]*optionType[i] : 0.0;
+            expectedGamma = expectedVega = 0.0;
+        } else {
+            BlackCalculator calculator(optionType[i], strike[i], fwd[i],
+                                       stdDev[i], discount[i]);
+            expectedDelta = calculator.deltaForward();
+            expectedGamma = calculator.gammaForward();
+            expectedVega = calculator.vega(1.0);
+        }
+
+        if (std::fabs(value[i] - expected) > tol*fwd[i]
+            || std::fabs(delta[i] - expectedDelta) > tol
+            || std::fabs(gamma[i] - expectedGamma)
+                   > tol*std::max(1.0, std::fabs(expectedGamma))
+            || std::fabs(vega[i] - expectedVega) > tol*fwd[i])
+            FAIL_CHECK("batch result differs from scalar formula for "
+                       << optionType[i]
+                       << " strike=" << strike[i]
+                       << " forward=" << fwd[i]
+                       << " stdDev=" << stdDev[i]
+                       << " discount=" << discount[i]
+                       << std::setprecision(16)
+                       << "\n    value: " << value[i] << " vs " << expected
+                       << "\n    delta: " << delta[i] << " vs " << expectedDelta
+                       << "\n    gamma: " << gamma[i] << " vs " << expectedGamma
+                       << "\n    vega:  " << vega[i] << " vs " << expectedVega);
+    }
+
+    // sensitivities are optional
+    std::vector<Real> valueOnly(n);
+    blackFormulaBatch(n, &optionType[0], &strike[0], &fwd[0], &stdDev[0],
+                      &discount[0], &valueOnly[0]);
+    CHECK(valueOnly == value);
+}
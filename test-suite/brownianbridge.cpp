@@ -20,9 +20,11 @@
 #include "utilities.hpp"
 #include <ql/methods/montecarlo/brownianbridge.hpp>
 #include <ql/methods/montecarlo/pathgenerator.hpp>
+#include <ql/math/randomnumbers/mt19937uniformrng.hpp>
 #include <ql/math/randomnumbers/sobolrsg.hpp>
 #include <ql/math/randomnumbers/inversecumulativersg.hpp>
 #include <ql/math/statistics/sequencestatistics.hpp>
+#include <ql/models/marketmodels/browniangenerators/sobolbrowniangenerator.hpp>
 #include <ql/processes/blackscholesprocess.hpp>
 #include <ql/termstructures/yield/flatforward.hpp>
 #include <ql/termstructures/volatility/equityfx/blackconstantvol.hpp>
@@ -55,6 +57,35 @@ namespace {
         return diff;
     }
 
+    // draws the variates for a number of 256-step, 8-factor market-model
+    // paths and checks their first two moments
+    void testMarketModelVariates(Size batchSize) {
+        Size factors = 8, steps = 256, paths = 4096;
+        SobolBrownianGenerator generator(factors, steps,
+                                         SobolBrownianGenerator::Diagonal,
+                                         42, SobolRsg::JoeKuoD7, batchSize);
+        std::vector<Real> variates(factors);
+        Real sum = 0.0, sumOfSquares = 0.0;
+        for (Size p=0; p<paths; ++p) {
+            generator.nextPath();
+            for (Size j=0; j<steps; ++j) {
+                generator.nextStep(variates);
+                for (Real x : variates) {
+                    sum += x;
+                    sumOfSquares += x*x;
+                }
+            }
+        }
+
+        Real n = static_cast<Real>(paths*steps*factors);
+        Real mean = sum/n, variance = sumOfSquares/n - mean*mean;
+        if (std::fabs(mean) > 1.0e-3 || std::fabs(variance - 1.0) > 1.0e-2)
+            FAIL_CHECK("unexpected moments of Brownian variates"
+                       << " (batch size " << batchSize << "):"
+                       << "\n    mean:     " << mean
+                       << "\n    variance: " << variance);
+    }
+
 }
 
 
@@ -263,3 +294,73 @@ TEST_CASE("BrownianBridge_PathGeneration", "[BrownianBridge]") {
                     << "    max error:  " << maxCovError);
     }
 }
+
+
+TEST_CASE("BrownianBridge_BatchTransform", "[BrownianBridge]") {
+    INFO("Testing Brownian-bridge transform of several samples...");
+
+    std::vector<Time> times = { 0.1, 0.2, 0.3, 0.5, 0.8, 1.0, 2.0,
+                                3.5, 5.0, 7.0, 9.0, 10.0, 12.5 };
+    BrownianBridge bridge(times);
+    Size N = times.size(), samples = 37;
+
+    MersenneTwisterUniformRng rng(42);
+    std::vector<Real> input(N*samples), output(N*samples);
+    for (Real& x : input)
+        x = rng.nextReal() - 0.5;
+    bridge.transformBatch(input.data(), output.data(), samples);
+
+    std::vector<Real> sample(N), expected(N);
+    for (Size p=0; p<samples; ++p) {
+        for (Size i=0; i<N; ++i)
+            sample[i] = input[i*samples+p];
+        bridge.transform(sample.begin(), sample.end(), expected.begin());
+        for (Size i=0; i<N; ++i) {
+            if (output[i*samples+p] != expected[i])
+                FAIL_CHECK("batch transform differs from single transform"
+                           << std::setprecision(16)
+                           << "\n    sample:     " << p
+                           << "\n    variate:    " << i
+                           << "\n    batch:      " << output[i*samples+p]
+                           << "\n    single:     " << expected[i]);
+        }
+    }
+
+    // batched Sobol Brownian generators return the same paths
+    Size factors = 8, steps = 256;
+    SobolBrownianGenerator generator1(factors, steps,
+                                      SobolBrownianGenerator::Diagonal, 42);
+    SobolBrownianGenerator generator2(factors, steps,
+                                      SobolBrownianGenerator::Diagonal, 42,
+                                      SobolRsg::Jaeckel, 32);
+    std::vector<Real> variates1(factors), variates2(factors);
+    for (Size p=0; p<100; ++p) {
+        Real weight1 = generator1.nextPath();
+        Real weight2 = generator2.nextPath();
+        if (weight1 != weight2)
+            FAIL_CHECK("batched generator returns weight " << weight2
+                       << " instead of " << weight1);
+        for (Size j=0; j<steps; ++j) {
+            generator1.nextStep(variates1);
+            generator2.nextStep(variates2);
+            if (variates1 != variates2)
+                FAIL("batched generator returns different variates"
+                     << "\n    path: " << p
+                     << "\n    step: " << j);
+        }
+    }
+}
+
+
+TEST_CASE("BrownianBridge_MarketModelVariatesPathByPath", "[BrownianBridge]") {
+    INFO("Testing market-model Brownian variates drawn path by path...");
+
+    testMarketModelVariates(1);
+}
+
+
+TEST_CASE("BrownianBridge_MarketModelVariatesBatch", "[BrownianBridge]") {
+    INFO("Testing market-model Brownian variates drawn in batches...");
+
+    testMarketModelVariates(256);
+}
@@ -689,3 +689,61 @@ TEST_CASE("Distribution_InvCDFviaStochasticCollocation", "[Distribution]") {
         }
     }
 }
+
+TEST_CASE("Distribution_BulkNormal", "[Distribution]") {
+
+    INFO("Testing bulk evaluation of normal distributions...");
+
+    const Size n = 20001;
+    std::vector<Real> x(n), u(n), result(n);
+    for (Size i=0; i<n; ++i) {
+        x[i] = -37.0 + 45.0*i/(n-1);
+        u[i] = (i + 0.5)/n;
+    }
+    // extreme tails of the inverse
+    u[0] = 1.0e-300;
+    u[n-1] = 1.0 - 1.0e-15;
+
+    // the scalar version loses relative accuracy around 1e-8, where
+    // it switches to an asymptotic expansion; compare with erfc instead
+    CumulativeNormalDistribution cum(average, sigma);
+    cum(&x[0], &x[0]+n, &result[0]);
+    for (Size i=0; i<n; ++i) {
+        const Real expected =
+            0.5*std::erfc(-(x[i]-average)/sigma*M_SQRT1_2);
+        if (std::fabs(result[i] - expected) > 1.0e-12*expected)
+            FAIL_CHECK("bulk cumulative normal differs from erfc"
+                       << QL_SCIENTIFIC
+                       << "\n    x:          " << x[i]
+                       << "\n    bulk:       " << result[i]
+                       << "\n    expected:   " << expected);
+    }
+
+    InverseCumulativeNormal invCum(average, sigma);
+    invCum(&u[0], &u[0]+n, &result[0]);
+    for (Size i=0; i<n; ++i) {
+        const Real expected = invCum(u[i]);
+        if (std::fabs(result[i] - expected)
+            > 1.0e-12*std::max(std::fabs(expected), 1.0))
+            FAIL_CHECK("bulk inverse cumulative normal differs "
+                       "from scalar version"
+                       << QL_SCIENTIFIC
+                       << "\n    u:          " << u[i]
+                       << "\n    bulk:       " << result[i]
+                       << "\n    scalar:     " << expected);
+    }
+
+    MoroInverseCumulativeNormal moroInvCum(average, sigma);
+    moroInvCum(&u[0], &u[0]+n, &result[0]);
+    for (Size i=0; i<n; ++i) {
+        const Real expected = moroInvCum(u[i]);
+        if (std::fabs(result[i] - expected)
+            > 1.0e-12*std::max(std::fabs(expected), 1.0))
+            FAIL_CHECK("bulk Moro inverse cumulative normal differs "
+                       "from scalar version"
+                       << QL_SCIENTIFIC
+                       << "\n    u:          " << u[i]
+                       << "\n    bulk:       " << result[i]
+                       << "\n    scalar:     " << expected);
+    }
+}
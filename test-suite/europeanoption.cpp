@@ -23,6 +23,7 @@
 #include <ql/time/calendars/target.hpp>
 #include <ql/time/daycounters/actual360.hpp>
 #include <ql/instruments/europeanoption.hpp>
+#include <ql/instruments/dividendvanillaoption.hpp>
 #include <ql/math/randomnumbers/rngtraits.hpp>
 #include <ql/math/interpolations/bicubicsplineinterpolation.hpp>
 #include <ql/math/interpolations/bilinearinterpolation.hpp>
@@ -1229,6 +1230,214 @@ TEST_CASE("EuropeanOption_QmcEngines", "[EuropeanOption]") {
     testEngineConsistency(engine, steps, samples, relativeTol);
 }
 
+TEST_CASE("EuropeanOption_McEnginesMultiThreaded", "[EuropeanOption]") {
+
+    INFO("Testing multi-threaded Monte Carlo European engines...");
+
+    SavedSettings backup;
+
+    DayCounter dc = Actual360();
+    Date today = Date::todaysDate();
+
+    std::shared_ptr<SimpleQuote> spot = std::make_shared<SimpleQuote>(100.0);
+    std::shared_ptr<YieldTermStructure> qTS = flatRate(today, 0.02, dc);
+    std::shared_ptr<YieldTermStructure> rTS = flatRate(today, 0.05, dc);
+    std::shared_ptr<BlackVolTermStructure> volTS = flatVol(today, 0.25, dc);
+    std::shared_ptr<BlackScholesMertonProcess> process =
+        std::make_shared<BlackScholesMertonProcess>(
+                                      Handle<Quote>(spot),
+                                      Handle<YieldTermStructure>(qTS),
+                                      Handle<YieldTermStructure>(rTS),
+                                      Handle<BlackVolTermStructure>(volTS));
+
+    std::shared_ptr<StrikedTypePayoff> payoff =
+        std::make_shared<PlainVanillaPayoff>(Option::Call, 105.0);
+    std::shared_ptr<Exercise> exercise =
+        std::make_shared<EuropeanExercise>(today + Period(1, Years));
+    EuropeanOption option(payoff, exercise);
+
+    option.setPricingEngine(
+                       std::make_shared<AnalyticEuropeanEngine>(process));
+    Real expected = option.NPV();
+
+    // pseudo-random streams: reproducible for a given number of threads
+    std::shared_ptr<PricingEngine> engine =
+        MakeMCEuropeanEngine<PseudoRandom>(process)
+        .withSteps(1)
+        .withAntitheticVariate()
+        .withSamples(20000)
+        .withSeed(42)
+        .withThreads(4);
+    option.setPricingEngine(engine);
+    Real calculated = option.NPV();
+    Real error = option.errorEstimate();
+    if (std::fabs(calculated-expected) > 3.0*error)
+        FAIL_CHECK("multi-threaded pseudo-random value out of tolerance:"
+                   << "\n    calculated: " << calculated
+                   << "\n    expected:   " << expected
+                   << "\n    error estimate: " << error);
+
+    option.setPricingEngine(
+        MakeMCEuropeanEngine<PseudoRandom>(process)
+        .withSteps(1)
+        .withAntitheticVariate()
+        .withSamples(20000)
+        .withSeed(42)
+        .withThreads(4));
+    Real repeated = option.NPV();
+    if (repeated != calculated)
+        FAIL_CHECK("multi-threaded pseudo-random value not reproducible:"
+                   << std::setprecision(16)
+                   << "\n    first run:  " << calculated
+                   << "\n    second run: " << repeated);
+
+    // low-discrepancy streams are contiguous blocks of the sequence,
+    // so the samples are the same as in the single-threaded engine
+    option.setPricingEngine(
+        MakeMCEuropeanEngine<LowDiscrepancy>(process)
+        .withSteps(1)
+        .withSamples(4095)
+        .withSeed(42));
+    Real serial = option.NPV();
+    option.setPricingEngine(
+        MakeMCEuropeanEngine<LowDiscrepancy>(process)
+        .withSteps(1)
+        .withSamples(4095)
+        .withSeed(42)
+        .withThreads(3));
+    Real parallel = option.NPV();
+    if (parallel != serial)
+        FAIL_CHECK("multi-threaded low-discrepancy value differs from "
+                   "single-threaded one:" << std::setprecision(16)
+                   << "\n    single-threaded: " << serial
+                   << "\n    multi-threaded:  " << parallel);
+}
+
+TEST_CASE("EuropeanOption_McEnginesThreadCountIndependence", "[EuropeanOption]") {
+
+    INFO("Testing independence of counter-based Monte Carlo results "
+         "from the number of threads...");
+
+    SavedSettings backup;
+
+    DayCounter dc = Actual360();
+    Date today = Date::todaysDate();
+
+    std::shared_ptr<SimpleQuote> spot = std::make_shared<SimpleQuote>(100.0);
+    std::shared_ptr<YieldTermStructure> qTS = flatRate(today, 0.02, dc);
+    std::shared_ptr<YieldTermStructure> rTS = flatRate(today, 0.05, dc);
+    std::shared_ptr<BlackVolTermStructure> volTS = flatVol(today, 0.25, dc);
+    std::shared_ptr<BlackScholesMertonProcess> process =
+        std::make_shared<BlackScholesMertonProcess>(
+                                      Handle<Quote>(spot),
+                                      Handle<YieldTermStructure>(qTS),
+                                      Handle<YieldTermStructure>(rTS),
+                                      Handle<BlackVolTermStructure>(volTS));
+
+    std::shared_ptr<StrikedTypePayoff> payoff =
+        std::make_shared<PlainVanillaPayoff>(Option::Call, 105.0);
+    std::shared_ptr<Exercise> exercise =
+        std::make_shared<EuropeanExercise>(today + Period(1, Years));
+    EuropeanOption option(payoff, exercise);
+
+    // a fixed number of samples is split among threads as contiguous
+    // blocks of a single stream, so the samples and their order don't
+    // depend on the number of threads
+    Size samples = 10001;
+    option.setPricingEngine(
+        MakeMCEuropeanEngine<PhiloxPseudoRandom>(process)
+        .withSteps(4)
+        .withAntitheticVariate()
+        .withSamples(samples)
+        .withSeed(42));
+    Real expected = option.NPV();
+    Real expectedError = option.errorEstimate();
+
+    for (Size threads : { 2, 3, 4, 7 }) {
+        option.setPricingEngine(
+            MakeMCEuropeanEngine<PhiloxPseudoRandom>(process)
+            .withSteps(4)
+            .withAntitheticVariate()
+            .withSamples(samples)
+            .withSeed(42)
+            .withThreads(threads));
+        Real calculated = option.NPV();
+        Real error = option.errorEstimate();
+        if (calculated != expected || error != expectedError)
+            FAIL_CHECK("multi-threaded counter-based simulation differs "
+                       "from single-threaded one:" << std::setprecision(16)
+                       << "\n    threads:                 " << threads
+                       << "\n    single-threaded value:   " << expected
+                       << "\n    multi-threaded value:    " << calculated
+                       << "\n    single-threaded error:   " << expectedError
+                       << "\n    multi-threaded error:    " << error);
+    }
+}
+
+TEST_CASE("EuropeanOption_McEnginesBatch", "[EuropeanOption]") {
+
+    INFO("Testing batch simulation in Monte Carlo European engines...");
+
+    SavedSettings backup;
+
+    DayCounter dc = Actual360();
+    Date today = Date::todaysDate();
+
+    std::shared_ptr<SimpleQuote> spot = std::make_shared<SimpleQuote>(100.0);
+    std::shared_ptr<YieldTermStructure> qTS = flatRate(today, 0.02, dc);
+    std::shared_ptr<YieldTermStructure> rTS = flatRate(today, 0.05, dc);
+    std::shared_ptr<BlackVolTermStructure> volTS = flatVol(today, 0.25, dc);
+    std::shared_ptr<BlackScholesMertonProcess> process =
+        std::make_shared<BlackScholesMertonProcess>(
+                                      Handle<Quote>(spot),
+                                      Handle<YieldTermStructure>(qTS),
+                                      Handle<YieldTermStructure>(rTS),
+                                      Handle<BlackVolTermStructure>(volTS));
+
+    std::shared_ptr<StrikedTypePayoff> payoff =
+        std::make_shared<PlainVanillaPayoff>(Option::Put, 95.0);
+    std::shared_ptr<Exercise> exercise =
+        std::make_shared<EuropeanExercise>(today + Period(1, Years));
+    EuropeanOption option(payoff, exercise);
+
+    // the paths are the same as in the path-by-path simulation,
+    // whatever the batch size
+    for (bool antithetic : { false, true }) {
+        option.setPricingEngine(
+            MakeMCEuropeanEngine<PseudoRandom>(process)
+            .withSteps(12)
+            .withBrownianBridge()
+            .withAntitheticVariate(antithetic)
+            .withAbsoluteTolerance(0.05)
+            .withSeed(42));
+        Real expected = option.NPV();
+        Real expectedError = option.errorEstimate();
+
+        for (Size batchSize : { 1, 100, 1024 }) {
+            option.setPricingEngine(
+                MakeMCEuropeanEngine<PseudoRandom>(process)
+                .withSteps(12)
+                .withBrownianBridge()
+                .withAntitheticVariate(antithetic)
+                .withAbsoluteTolerance(0.05)
+                .withSeed(42)
+                .withBatchSize(batchSize));
+            Real calculated = option.NPV();
+            Real error = option.errorEstimate();
+            if (calculated != expected || error != expectedError)
+                FAIL_CHECK("batch simulation differs from path-by-path one:"
+                           << std::setprecision(16)
+                           << "\n    antithetic:     " << antithetic
+                           << "\n    batch size:     " << batchSize
+                           << "\n    path by path:   " << expected
+                           << " +/- " << expectedError
+                           << "\n    batch:          " << calculated
+                           << " +/- " << error);
+        }
+    }
+}
+
+
 TEST_CASE("EuropeanOption_FFTEngines", "[EuropeanOption]") {
 
     INFO("Testing FFT European engines "
@@ -1521,3 +1730,130 @@ TEST_CASE("EuropeanOption_AnalyticEngineDiscountCurve", "[EuropeanOption]") {
     npvMultiCurve = option.NPV();
     CHECK(npvSingleCurve != npvMultiCurve);
 }
+
+TEST_CASE("EuropeanOption_FdMultipleStrikes", "[EuropeanOption]") {
+    INFO("Testing multiple strikes FD engine for European options...");
+
+    SavedSettings backup;
+
+    DayCounter dc = Actual360();
+    Date today = Date::todaysDate();
+
+    std::shared_ptr < SimpleQuote > spot = std::make_shared<SimpleQuote>(100.0);
+    std::shared_ptr < YieldTermStructure > qTS = flatRate(today, 0.02, dc);
+    std::shared_ptr < YieldTermStructure > rTS = flatRate(today, 0.05, dc);
+    std::shared_ptr < BlackVolTermStructure > volTS = flatVol(today, 0.25, dc);
+
+    std::shared_ptr < BlackScholesMertonProcess > stochProcess =
+            std::make_shared<BlackScholesMertonProcess>(Handle<Quote>(spot),
+                                                        Handle<YieldTermStructure>(qTS),
+                                                        Handle<YieldTermStructure>(rTS),
+                                                        Handle<BlackVolTermStructure>(volTS));
+
+    std::vector<Real> strikes;
+    for (Real strike = 70.0; strike <= 130.0; strike += 5.0)
+        strikes.push_back(strike);
+
+    std::shared_ptr < FdBlackScholesVanillaEngine > fdEngine =
+            std::make_shared<FdBlackScholesVanillaEngine>(stochProcess, 100, 400);
+    fdEngine->enableMultipleStrikesCaching(strikes);
+    std::shared_ptr < PricingEngine > analyticEngine =
+            std::make_shared<AnalyticEuropeanEngine>(stochProcess);
+
+    std::shared_ptr < Exercise > exercise =
+            std::make_shared<EuropeanExercise>(today + Period(1, Years));
+
+    for (Option::Type type : { Option::Put, Option::Call }) {
+        for (Real strike : strikes) {
+            EuropeanOption option(
+                std::make_shared<PlainVanillaPayoff>(type, strike), exercise);
+
+            option.setPricingEngine(analyticEngine);
+            const Real expectedNPV = option.NPV();
+            const Real expectedDelta = option.delta();
+            const Real expectedGamma = option.gamma();
+
+            option.setPricingEngine(fdEngine);
+            const Real calculatedNPV = option.NPV();
+            const Real calculatedDelta = option.delta();
+            const Real calculatedGamma = option.gamma();
+
+            if (std::fabs(calculatedNPV - expectedNPV) > 5e-3
+                || std::fabs(calculatedDelta - expectedDelta) > 1e-4
+                || std::fabs(calculatedGamma - expectedGamma) > 1e-4) {
+                FAIL_CHECK("failed to reproduce analytic results for "
+                           << type << " with strike " << strike
+                           << "\n    npv:   " << calculatedNPV
+                           << " vs " << expectedNPV
+                           << "\n    delta: " << calculatedDelta
+                           << " vs " << expectedDelta
+                           << "\n    gamma: " << calculatedGamma
+                           << " vs " << expectedGamma);
+            }
+        }
+    }
+}
+
+TEST_CASE("EuropeanOption_FdMultipleStrikesWithDividends", "[EuropeanOption]") {
+    INFO("Testing multiple strikes FD engine for European options "
+         "with discrete dividends...");
+
+    SavedSettings backup;
+
+    DayCounter dc = Actual360();
+    Date today = Date::todaysDate();
+
+    std::shared_ptr < SimpleQuote > spot = std::make_shared<SimpleQuote>(100.0);
+    std::shared_ptr < YieldTermStructure > qTS = flatRate(today, 0.0, dc);
+    std::shared_ptr < YieldTermStructure > rTS = flatRate(today, 0.05, dc);
+    std::shared_ptr < BlackVolTermStructure > volTS = flatVol(today, 0.25, dc);
+
+    std::shared_ptr < BlackScholesMertonProcess > stochProcess =
+            std::make_shared<BlackScholesMertonProcess>(Handle<Quote>(spot),
+                                                        Handle<YieldTermStructure>(qTS),
+                                                        Handle<YieldTermStructure>(rTS),
+                                                        Handle<BlackVolTermStructure>(volTS));
+
+    std::vector<Real> strikes;
+    for (Real strike = 70.0; strike <= 130.0; strike += 5.0)
+        strikes.push_back(strike);
+
+    std::vector<Date> dividendDates = { today + Period(3, Months),
+                                        today + Period(9, Months) };
+    std::vector<Real> dividends = { 6.0, 6.0 };
+
+    std::shared_ptr < FdBlackScholesVanillaEngine > multiStrikeEngine =
+            std::make_shared<FdBlackScholesVanillaEngine>(stochProcess, 100, 400);
+    multiStrikeEngine->enableMultipleStrikesCaching(strikes);
+    std::shared_ptr < PricingEngine > singleStrikeEngine =
+            std::make_shared<FdBlackScholesVanillaEngine>(stochProcess, 100, 400);
+
+    std::shared_ptr < Exercise > exercise =
+            std::make_shared<EuropeanExercise>(today + Period(1, Years));
+
+    for (Option::Type type : { Option::Put, Option::Call }) {
+        for (Real strike : strikes) {
+            DividendVanillaOption option(
+                std::make_shared<PlainVanillaPayoff>(type, strike), exercise,
+                dividendDates, dividends);
+
+            option.setPricingEngine(singleStrikeEngine);
+            const Real expectedNPV = option.NPV();
+            const Real expectedDelta = option.delta();
+
+            option.setPricingEngine(multiStrikeEngine);
+            const Real calculatedNPV = option.NPV();
+            const Real calculatedDelta = option.delta();
+
+            if (std::fabs(calculatedNPV - expectedNPV) > 1e-2
+                || std::fabs(calculatedDelta - expectedDelta) > 1e-3) {
+                FAIL_CHECK("failed to reproduce single-strike results for "
+                           << type << " with strike " << strike
+                           << "\n    npv:   " << calculatedNPV
+                           << " vs " << expectedNPV
+                           << "\n    delta: " << calculatedDelta
+                           << " vs " << expectedDelta);
+            }
+        }
+    }
+}
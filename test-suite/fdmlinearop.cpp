@@ -28,6 +28,7 @@
 #include <ql/processes/hullwhiteprocess.hpp>
 #include <ql/processes/blackscholesprocess.hpp>
 #include <ql/processes/hybridhestonhullwhiteprocess.hpp>
+#include <ql/processes/ornsteinuhlenbeckprocess.hpp>
 #include <ql/experimental/math/numericaldifferentiation.hpp>
 #include <ql/math/interpolations/bilinearinterpolation.hpp>
 #include <ql/math/interpolations/bicubicsplineinterpolation.hpp>
@@ -35,6 +36,7 @@
 #include <ql/math/integrals/discreteintegrals.hpp>
 #include <ql/math/randomnumbers/rngtraits.hpp>
 #include <ql/models/equity/hestonmodel.hpp>
+#include <ql/termstructures/yield/flatforward.hpp>
 #include <ql/termstructures/yield/zerocurve.hpp>
 #include <ql/pricingengines/vanilla/analyticeuropeanengine.hpp>
 #include <ql/pricingengines/vanilla/mchestonhullwhiteengine.hpp>
@@ -50,8 +52,10 @@
 #include <ql/methods/finitedifferences/meshers/fdmblackscholesmesher.hpp>
 #include <ql/methods/finitedifferences/solvers/fdmbackwardsolver.hpp>
 #include <ql/methods/finitedifferences/operators/fdmblackscholesop.hpp>
+#include <ql/methods/finitedifferences/operators/fdmornsteinuhlenbeckop.hpp>
 #include <ql/methods/finitedifferences/utilities/fdmmesherintegral.hpp>
 #include <ql/methods/finitedifferences/utilities/fdminnervaluecalculator.hpp>
+#include <ql/methods/finitedifferences/utilities/fdmsparselinearsolver.hpp>
 #include <ql/methods/finitedifferences/operators/fdmlinearop.hpp>
 #include <ql/methods/finitedifferences/operators/fdmlinearoplayout.hpp>
 #include <ql/methods/finitedifferences/operators/fdmlinearopcomposite.hpp>
@@ -69,6 +73,7 @@
 #include <ql/methods/finitedifferences/operators/secondderivativeop.hpp>
 #include <ql/methods/finitedifferences/operators/secondordermixedderivativeop.hpp>
 #include <ql/math/matrixutilities/sparseilupreconditioner.hpp>
+#include <ql/utilities/threadpool.hpp>
 #include <functional>
 #include <numeric>
 
@@ -208,6 +213,51 @@ TEST_CASE("FdmLinearOp_FdmLinearOpLayout", "[FdmLinearOp]") {
     }
 }
 
+TEST_CASE("FdmLinearOp_StrideBasedLayout", "[FdmLinearOp]") {
+
+    INFO("Testing stride-based access to a linear operator layout...");
+
+    Size dims[] = {5, 7, 8};
+    const std::vector<Size> dim(dims, dims + LENGTH(dims));
+
+    const std::shared_ptr<FdmLinearOpLayout> layout =
+        std::make_shared<FdmLinearOpLayout>(dim);
+
+    std::vector<std::shared_ptr<Fdm1dMesher> > meshers;
+    for (Size d : dim)
+        meshers.push_back(
+            std::make_shared<Concentrating1dMesher>(0.0, 1.0, d,
+                std::pair<Real, Real>(0.3, 0.1)));
+    const FdmMesherComposite mesher(layout, meshers);
+
+    for (Size d = 0; d < dim.size(); ++d) {
+        std::vector<Size> coordinate(layout->size(), Null<Size>());
+
+        REQUIRE(layout->lines(d)*dim[d] == layout->size());
+        for (Size l = 0; l < layout->lines(d); ++l) {
+            for (Size c = 0; c < dim[d]; ++c) {
+                const Size i = layout->lineStart(d, l) + c*layout->spacing()[d];
+                REQUIRE(coordinate[i] == Null<Size>());
+                coordinate[i] = c;
+            }
+        }
+
+        const Array locations = mesher.locations(d);
+        const FdmLinearOpIterator endIter = layout->end();
+        for (FdmLinearOpIterator iter = layout->begin(); iter != endIter; ++iter) {
+            const Size i = iter.index();
+            REQUIRE(coordinate[i] == iter.coordinates()[d]);
+            REQUIRE(layout->coordinate(i, d) == iter.coordinates()[d]);
+            REQUIRE(locations[i] == mesher.location(iter, d));
+
+            for (Integer offset = -2; offset <= 2; ++offset) {
+                REQUIRE(layout->neighbourhood(i, coordinate[i], d, offset)
+                        == layout->iter_neighbourhood(iter, d, offset).index());
+            }
+        }
+    }
+}
+
 TEST_CASE("FdmLinearOp_UniformGridMesher", "[FdmLinearOp]") {
 
     INFO("Testing uniform grid mesher...");
@@ -1469,3 +1519,441 @@ TEST_CASE("FdmLinearOp_FdmMesherIntegral", "[FdmLinearOp]") {
                      << "\n    expected:   " << expectedTrapezoid);
     }
 }
+
+TEST_CASE("FdmLinearOp_InPlaceApplication", "[FdmLinearOp]") {
+    INFO("Testing in-place application of composite operators...");
+
+    SavedSettings backup;
+
+    Size dims[] = {40, 20};
+    const std::vector<Size> dim(dims, dims + LENGTH(dims));
+
+    std::shared_ptr < FdmLinearOpLayout > index = std::make_shared<FdmLinearOpLayout>(dim);
+
+    std::vector<std::pair<Real, Real> > boundaries;
+    boundaries.emplace_back(std::pair < Real, Real > (3.8, 4.905274778));
+    boundaries.emplace_back(std::pair < Real, Real > (0.000, 1.0));
+
+    std::shared_ptr < FdmMesher > mesher =
+            std::make_shared<UniformGridMesher>(index, boundaries);
+
+    Handle<Quote> s0(std::make_shared<SimpleQuote>(100.0));
+
+    Handle<YieldTermStructure> rTS(flatRate(0.05, Actual365Fixed()));
+    Handle<YieldTermStructure> qTS(flatRate(0.02, Actual365Fixed()));
+    Handle<BlackVolTermStructure> volTS(flatVol(0.25, Actual365Fixed()));
+
+    std::shared_ptr < HestonProcess > hestonProcess =
+            std::make_shared<HestonProcess>(rTS, qTS, s0, 0.04, 2.5, 0.04, 0.66, -0.8);
+    std::shared_ptr < GeneralizedBlackScholesProcess > bsProcess =
+            std::make_shared<GeneralizedBlackScholesProcess>(s0, qTS, rTS, volTS);
+
+    std::vector<std::shared_ptr<FdmLinearOpComposite> > ops;
+    ops.emplace_back(std::make_shared<FdmHestonOp>(mesher, hestonProcess));
+    ops.emplace_back(std::make_shared<FdmBlackScholesOp>(mesher, bsProcess, 100.0));
+
+    Array u(index->size());
+    for (Size i = 0; i < u.size(); ++i)
+        u[i] = std::sin(0.1 * i) + std::cos(0.35 * i);
+
+    for (const auto& op : ops) {
+        op->setTime(0.25, 0.5);
+
+        Array result;
+        op->apply_into(u, result);
+        REQUIRE(result == op->apply(u));
+        op->apply_mixed_into(u, result);
+        REQUIRE(result == op->apply_mixed(u));
+        op->preconditioner_into(u, 0.1, result);
+        REQUIRE(result == op->preconditioner(u, 0.1));
+
+        for (Size direction = 0; direction < dim.size(); ++direction) {
+            op->apply_direction_into(direction, u, result);
+            REQUIRE(result == op->apply_direction(direction, u));
+
+            const Array expected = op->solve_splitting(direction, u, -0.1);
+            op->solve_splitting_into(direction, u, -0.1, result);
+            REQUIRE(result == expected);
+
+            // the solution may overwrite the right-hand side
+            result = u;
+            op->solve_splitting_into(direction, result, -0.1, result);
+            REQUIRE(result == expected);
+        }
+    }
+}
+
+TEST_CASE("FdmLinearOp_InPlaceImplicitEulerStep", "[FdmLinearOp]") {
+    INFO("Testing implicit Euler steps with reused work arrays...");
+
+    SavedSettings backup;
+
+    Size dims[] = {40, 20};
+    const std::vector<Size> dim(dims, dims + LENGTH(dims));
+
+    std::shared_ptr < FdmLinearOpLayout > index = std::make_shared<FdmLinearOpLayout>(dim);
+
+    std::vector<std::pair<Real, Real> > boundaries;
+    boundaries.emplace_back(std::pair < Real, Real > (3.8, 4.905274778));
+    boundaries.emplace_back(std::pair < Real, Real > (0.000, 1.0));
+
+    std::shared_ptr < FdmMesher > mesher =
+            std::make_shared<UniformGridMesher>(index, boundaries);
+
+    Handle<Quote> s0(std::make_shared<SimpleQuote>(100.0));
+    Handle<YieldTermStructure> rTS(flatRate(0.05, Actual365Fixed()));
+    Handle<YieldTermStructure> qTS(flatRate(0.02, Actual365Fixed()));
+
+    std::shared_ptr<FdmLinearOpComposite> op = std::make_shared<FdmHestonOp>(
+        mesher, std::make_shared<HestonProcess>(
+            rTS, qTS, s0, 0.04, 2.5, 0.04, 0.66, -0.8));
+
+    Array u(index->size());
+    for (Size i = 0; i < u.size(); ++i)
+        u[i] = std::sin(0.1 * i) + std::cos(0.35 * i);
+    Array expected = u;
+
+    const Time dt = 0.01;
+    ImplicitEulerScheme scheme(op);
+    scheme.setStep(dt);
+
+    for (Time t = 0.5; t > 0.45; t -= dt) {
+        scheme.step(u, t);
+
+        op->setTime(t - dt, t);
+        expected = BiCGstab(
+            [&](const Array& r) { return Array(r - dt * op->apply(r)); },
+            10 * expected.size(), 1e-8,
+            [&](const Array& r) { return op->preconditioner(r, -dt); })
+            .solve(expected, expected).x;
+
+        REQUIRE(u == expected);
+    }
+}
+
+TEST_CASE("FdmLinearOp_MultiThreadedSplitting", "[FdmLinearOp]") {
+    INFO("Testing multi-threaded splitting of composite operators...");
+
+    SavedSettings backup;
+
+    const Date today = Date(28, March, 2004);
+    Settings::instance().evaluationDate() = today;
+    const Time maturity = 2.0;
+
+    Size dims[] = {21, 11, 11};
+    const std::vector<Size> dim(dims, dims + LENGTH(dims));
+
+    std::shared_ptr < HybridHestonHullWhiteProcess > jointProcess
+            = createHestonHullWhite(maturity);
+    FdmSolverDesc desc = createSolverDesc(dim, jointProcess);
+    std::shared_ptr < FdmMesher > mesher = desc.mesher;
+
+    std::shared_ptr < HullWhiteForwardProcess > hwFwdProcess
+            = jointProcess->hullWhiteProcess();
+    std::shared_ptr < HullWhiteProcess > hwProcess =
+            std::make_shared<HullWhiteProcess>(jointProcess->hestonProcess()->riskFreeRate(),
+                                               hwFwdProcess->a(), hwFwdProcess->sigma());
+
+    std::vector<std::shared_ptr<FdmLinearOpComposite> > ops;
+    ops.emplace_back(std::make_shared<FdmHestonHullWhiteOp>(
+                         mesher, jointProcess->hestonProcess(),
+                         hwProcess, jointProcess->eta()));
+    ops.emplace_back(std::make_shared<FdmHestonOp>(
+                         mesher, jointProcess->hestonProcess()));
+
+    Array u(mesher->layout()->size());
+    for (Size i = 0; i < u.size(); ++i)
+        u[i] = std::sin(0.1 * i) + std::cos(0.35 * i);
+
+    const std::shared_ptr<ThreadPool> pool = std::make_shared<ThreadPool>(3);
+
+    for (const auto& op : ops) {
+        op->setTime(0.25, 0.5);
+
+        std::vector<Array> serial, parallel;
+        for (bool multiThreaded : { false, true }) {
+            op->setThreadPool(multiThreaded ? pool : nullptr);
+            std::vector<Array>& results = multiThreaded ? parallel : serial;
+
+            Array result;
+            op->apply_into(u, result);
+            results.push_back(result);
+            op->apply_mixed_into(u, result);
+            results.push_back(result);
+            for (Size direction = 0; direction < op->size(); ++direction) {
+                op->apply_direction_into(direction, u, result);
+                results.push_back(result);
+                op->solve_splitting_into(direction, u, -0.1, result);
+                results.push_back(result);
+            }
+        }
+        for (Size i = 0; i < serial.size(); ++i)
+            REQUIRE(parallel[i] == serial[i]);
+
+        // a full rollback
+        Array serialValues = u, parallelValues = u;
+        const Real theta = 0.5 + std::sqrt(3.0) / 6.;
+        for (bool multiThreaded : { false, true }) {
+            op->setThreadPool(multiThreaded ? pool : nullptr);
+            HundsdorferScheme evolver(theta, 0.5, op);
+            FiniteDifferenceModel<HundsdorferScheme> model(evolver);
+            model.rollback(multiThreaded ? parallelValues : serialValues,
+                           maturity, 0.0, 10);
+        }
+        REQUIRE(parallelValues == serialValues);
+    }
+}
+
+TEST_CASE("FdmLinearOp_MultiPayoffRollback", "[FdmLinearOp]") {
+    INFO("Testing rollback of several payoffs in a single sweep...");
+
+    SavedSettings backup;
+
+    Size dims[] = {40, 20};
+    const std::vector<Size> dim(dims, dims + LENGTH(dims));
+
+    std::shared_ptr < FdmLinearOpLayout > index = std::make_shared<FdmLinearOpLayout>(dim);
+
+    std::vector<std::pair<Real, Real> > boundaries;
+    boundaries.emplace_back(std::pair < Real, Real > (3.8, std::log(220.0)));
+    boundaries.emplace_back(std::pair < Real, Real > (0.000, 1.0));
+
+    std::shared_ptr < FdmMesher > mesher =
+            std::make_shared<UniformGridMesher>(index, boundaries);
+
+    Handle<Quote> s0(std::make_shared<SimpleQuote>(100.0));
+
+    Handle<YieldTermStructure> rTS(flatRate(0.05, Actual365Fixed()));
+    Handle<YieldTermStructure> qTS(flatRate(0.02, Actual365Fixed()));
+
+    std::shared_ptr < HestonProcess > hestonProcess =
+            std::make_shared<HestonProcess>(rTS, qTS, s0, 0.04, 2.5, 0.04, 0.66, -0.8);
+
+    std::shared_ptr < FdmLinearOpComposite > op =
+            std::make_shared<FdmHestonOp>(mesher, hestonProcess);
+
+    // american puts and european calls on several strikes
+    std::vector<Array> payoffs;
+    std::vector<std::shared_ptr<FdmStepConditionComposite> > conditions;
+    for (Real strike : { 90.0, 100.0, 110.0 }) {
+        for (Option::Type type : { Option::Put, Option::Call }) {
+            const std::shared_ptr<Payoff> payoff =
+                std::make_shared<PlainVanillaPayoff>(type, strike);
+
+            Array rhs(mesher->layout()->size());
+            const FdmLinearOpIterator endIter = mesher->layout()->end();
+            for (FdmLinearOpIterator iter = mesher->layout()->begin();
+                 iter != endIter; ++iter) {
+                rhs[iter.index()]
+                        = payoff->operator()(std::exp(mesher->location(iter, 0)));
+            }
+            payoffs.push_back(rhs);
+
+            FdmStepConditionComposite::Conditions stepConditions;
+            if (type == Option::Put)
+                stepConditions.emplace_back(std::make_shared<FdmAmericanStepCondition>(
+                    mesher, std::make_shared<FdmLogInnerValue>(payoff, mesher, 0)));
+            conditions.emplace_back(std::make_shared<FdmStepConditionComposite>(
+                std::list<std::vector<Time> >(), stepConditions));
+        }
+    }
+
+    for (const FdmSchemeDesc& scheme : { FdmSchemeDesc::Hundsdorfer(),
+                                         FdmSchemeDesc::Douglas() }) {
+        FdmBackwardSolver solver(op, FdmBoundaryConditionSet(),
+                                 std::shared_ptr<FdmStepConditionComposite>(),
+                                 scheme);
+
+        std::vector<Array> calculated = payoffs;
+        solver.rollback(calculated, conditions, 1.0, 0.0, 25, 2);
+
+        for (Size i = 0; i < payoffs.size(); ++i) {
+            Array expected = payoffs[i];
+            FdmBackwardSolver(op, FdmBoundaryConditionSet(),
+                              conditions[i], scheme)
+                .rollback(expected, 1.0, 0.0, 25, 2);
+
+            REQUIRE(calculated[i] == expected);
+        }
+    }
+}
+
+TEST_CASE("FdmLinearOp_CachedFactorization", "[FdmLinearOp]") {
+    INFO("Testing the cached factorization of triple band operators...");
+
+    const std::shared_ptr<FdmMesher> mesher =
+        std::make_shared<FdmMesherComposite>(
+            std::make_shared<Concentrating1dMesher>(
+                -2.0, 3.0, 21, std::make_pair(0.5, 0.1)),
+            std::make_shared<Uniform1dMesher>(-1.0, 1.0, 30));
+
+    const FirstDerivativeOp dx(1, mesher);
+    const SecondDerivativeOp dxx(1, mesher);
+    TripleBandLinearOp op(1, mesher);
+    op.axpbyc(0.03, dx, 0.02, dxx, -0.05);
+
+    Array u(mesher->layout()->size());
+    for (Size i = 0; i < u.size(); ++i)
+        u[i] = std::sin(0.1 * i) + std::cos(0.35 * i);
+
+    ThreadPool pool(3);
+
+    // repeated solves reuse the factorization, which must be
+    // renewed when the coefficients or the bands change
+    Array result;
+    for (Real a : { -0.1, -0.1, -0.2, -0.2 }) {
+        for (ThreadPool* p : { static_cast<ThreadPool*>(nullptr), &pool }) {
+            op.solve_splitting_into(u, a, 1.0, result, p);
+            REQUIRE(result == op.solve_splitting(u, a, 1.0));
+        }
+    }
+
+    op.axpbyc(0.01, dx, 0.04, dxx, -0.02);
+    op.solve_splitting_into(u, -0.2, 1.0, result);
+    REQUIRE(result == op.solve_splitting(u, -0.2, 1.0));
+
+    Array inPlace = u;
+    op.solve_splitting_into(inPlace, -0.2, 1.0, inPlace, &pool);
+    REQUIRE(inPlace == result);
+
+    TripleBandLinearOp copy(op);
+    copy.axpbyc(0.02, dx, 0.01, dxx, -0.03);
+    copy.swap(op);
+    op.solve_splitting_into(u, -0.2, 1.0, result);
+    REQUIRE(result == op.solve_splitting(u, -0.2, 1.0));
+}
+
+TEST_CASE("FdmLinearOp_SimpleCompoundedFlatCurve", "[FdmLinearOp]") {
+    INFO("Testing operators on flat curves with simple compounding...");
+
+    SavedSettings backup;
+
+    const Date today = Date(28, March, 2004);
+    Settings::instance().evaluationDate() = today;
+    const DayCounter dc = Actual365Fixed();
+
+    // a flat simple rate implies a forward rate decreasing with time,
+    // so the operators must be updated at each step
+    const std::shared_ptr<YieldTermStructure> rTS =
+        std::make_shared<FlatForward>(today, 0.2, dc, Simple);
+    const std::shared_ptr<YieldTermStructure> qTS = flatRate(today, 0.02, dc);
+
+    const std::shared_ptr<FdmMesher> mesher =
+        std::make_shared<FdmMesherComposite>(
+            std::make_shared<Uniform1dMesher>(
+                std::log(50.0), std::log(150.0), 51));
+
+    Array u(mesher->layout()->size());
+    for (Size i = 0; i < u.size(); ++i)
+        u[i] = std::sin(0.1 * i) + std::cos(0.35 * i);
+
+    const std::shared_ptr<GeneralizedBlackScholesProcess> bsProcess =
+        std::make_shared<BlackScholesMertonProcess>(
+            Handle<Quote>(std::make_shared<SimpleQuote>(100.0)),
+            Handle<YieldTermStructure>(qTS),
+            Handle<YieldTermStructure>(rTS),
+            Handle<BlackVolTermStructure>(flatVol(today, 0.25, dc)));
+
+    FdmBlackScholesOp bsOp(mesher, bsProcess, 100.0);
+    bsOp.setTime(0.0, 0.1);
+    bsOp.setTime(4.9, 5.0);
+    FdmBlackScholesOp bsExpected(mesher, bsProcess, 100.0);
+    bsExpected.setTime(4.9, 5.0);
+    if (bsOp.apply(u) != bsExpected.apply(u)
+        || bsOp.solve_splitting(0, u, -0.1)
+               != bsExpected.solve_splitting(0, u, -0.1))
+        FAIL_CHECK("Black-Scholes operator not updated "
+                   "on a simple-compounded flat curve");
+
+    const std::shared_ptr<OrnsteinUhlenbeckProcess> ouProcess =
+        std::make_shared<OrnsteinUhlenbeckProcess>(1.0, 0.1);
+
+    FdmOrnsteinUhlenbackOp ouOp(mesher, ouProcess, rTS,
+                                FdmBoundaryConditionSet());
+    ouOp.setTime(0.0, 0.1);
+    ouOp.setTime(4.9, 5.0);
+    FdmOrnsteinUhlenbackOp ouExpected(mesher, ouProcess, rTS,
+                                      FdmBoundaryConditionSet());
+    ouExpected.setTime(4.9, 5.0);
+    if (ouOp.apply(u) != ouExpected.apply(u)
+        || ouOp.solve_splitting(0, u, -0.1)
+               != ouExpected.solve_splitting(0, u, -0.1))
+        FAIL_CHECK("Ornstein-Uhlenbeck operator not updated "
+                   "on a simple-compounded flat curve");
+}
+
+TEST_CASE("FdmLinearOp_SparseImplicitSolver", "[FdmLinearOp]") {
+    INFO("Testing the sparse solver of implicit steps...");
+
+    SavedSettings backup;
+
+    const Date today = Date(28, March, 2004);
+    Settings::instance().evaluationDate() = today;
+    const Time maturity = 1.0;
+
+    Size dims[] = {21, 11, 11};
+    const std::vector<Size> dim(dims, dims + LENGTH(dims));
+
+    std::shared_ptr < HybridHestonHullWhiteProcess > jointProcess
+            = createHestonHullWhite(maturity);
+    FdmSolverDesc desc = createSolverDesc(dim, jointProcess);
+    std::shared_ptr < FdmMesher > mesher = desc.mesher;
+
+    std::shared_ptr < HullWhiteForwardProcess > hwFwdProcess
+            = jointProcess->hullWhiteProcess();
+    std::shared_ptr < HullWhiteProcess > hwProcess =
+            std::make_shared<HullWhiteProcess>(jointProcess->hestonProcess()->riskFreeRate(),
+                                               hwFwdProcess->a(), hwFwdProcess->sigma());
+
+    const std::shared_ptr<FdmLinearOpComposite> op =
+        std::make_shared<FdmHestonHullWhiteOp>(
+            mesher, jointProcess->hestonProcess(),
+            hwProcess, jointProcess->eta());
+
+    Array u(mesher->layout()->size());
+    for (Size i = 0; i < u.size(); ++i)
+        u[i] = std::sin(0.1 * i) + std::cos(0.35 * i);
+
+    const Real dt = 0.05;
+    op->setTime(0.5, 0.5 + dt);
+
+    FdmSparseLinearSolver solver(op);
+    solver.setStep(dt);
+    Array x = u;
+    solver.solve(x);
+
+    const Array residual = x - dt * op->apply(x) - u;
+    const Real error = std::sqrt(DotProduct(residual, residual)
+                                 / DotProduct(u, u));
+    if (error > 1e-7)
+        FAIL_CHECK("failed to solve the implicit step"
+                   << "\n    relative residual: " << error);
+
+    // a slightly different step keeps the factorization,
+    // a much larger one triggers a new one
+    op->setTime(0.45, 0.45 + dt);
+    solver.setStep(dt);
+    REQUIRE(solver.factorizations() == 1);
+    solver.setStep(10 * dt);
+    REQUIRE(solver.factorizations() == 2);
+
+    // rollbacks with both solvers agree
+    Array expected = u, calculated = u;
+    for (auto solverType : { ImplicitEulerScheme::BiCGstab,
+                             ImplicitEulerScheme::SparseBiCGstab }) {
+        ImplicitEulerScheme evolver(op, ImplicitEulerScheme::bc_set(),
+                                    1e-10, solverType);
+        FiniteDifferenceModel<ImplicitEulerScheme> model(evolver);
+        model.rollback(solverType == ImplicitEulerScheme::BiCGstab
+                       ? expected : calculated, maturity, 0.0, 10);
+    }
+
+    const Real tol = 1e-8;
+    for (Size i = 0; i < u.size(); ++i) {
+        if (std::fabs(expected[i] - calculated[i]) > tol)
+            FAIL_CHECK("failed to reproduce the rollback"
+                       << "\n    index:      " << i
+                       << "\n    calculated: " << calculated[i]
+                       << "\n    expected:   " << expected[i]);
+    }
+}
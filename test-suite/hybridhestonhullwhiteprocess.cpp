@@ -49,6 +49,7 @@
 #include <ql/pricingengines/vanilla/analytichestonhullwhiteengine.hpp>
 #include <ql/pricingengines/vanilla/fdhestonvanillaengine.hpp>
 #include <ql/pricingengines/vanilla/fdhestonhullwhitevanillaengine.hpp>
+#include <ql/utilities/threadpool.hpp>
 #include <functional>
 
 using namespace QuantLib;
@@ -870,6 +871,8 @@ TEST_CASE("HybridHestonHullWhiteProcess_FdmHestonHullWhiteEngine", "[HybridHesto
     const Real corr[] = {-0.85, 0.5};
     const Real strike[] = {75, 120, 160};
 
+    const std::shared_ptr<ThreadPool> pool = std::make_shared<ThreadPool>(3);
+
     for (Size i = 0; i < LENGTH(corr); ++i) {
         for (Size j = 0; j < LENGTH(strike); ++j) {
             std::shared_ptr < StrikedTypePayoff > payoff =
@@ -883,6 +886,25 @@ TEST_CASE("HybridHestonHullWhiteProcess_FdmHestonHullWhiteEngine", "[HybridHesto
             const Real calculatedDelta = option.delta();
             const Real calculatedGamma = option.gamma();
 
+            // the solver splits its operator over the threads of the
+            // pool; the results must not change
+            std::shared_ptr<FdHestonHullWhiteVanillaEngine> multiThreaded =
+                std::make_shared<FdHestonHullWhiteVanillaEngine>(
+                    std::make_shared<HestonModel>(hestonProcess),
+                    hwProcess, corr[i], 50, 200, 10, 15);
+            multiThreaded->setThreadPool(pool);
+            option.setPricingEngine(multiThreaded);
+            if (option.NPV() != calculated
+                || option.delta() != calculatedDelta
+                || option.gamma() != calculatedGamma) {
+                FAIL_CHECK("Failed to reproduce results with multiple threads"
+                                   << std::setprecision(12)
+                                   << "\n   corr:       " << corr[i]
+                                   << "\n   strike:     " << strike[j]
+                                   << "\n   calculated: " << option.NPV()
+                                   << "\n   expected:   " << calculated);
+            }
+
             option.setPricingEngine(std::make_shared<AnalyticBSMHullWhiteEngine>(corr[i],
                                                                                  stochProcess, hwModel));
             const Real expected = option.NPV();
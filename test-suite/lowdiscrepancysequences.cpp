@@ -19,10 +19,12 @@
 */
 
 #include "utilities.hpp"
+#include <ql/math/distributions/normaldistribution.hpp>
 #include <ql/math/statistics/discrepancystatistics.hpp>
 #include <ql/math/statistics/sequencestatistics.hpp>
 #include <ql/math/randomnumbers/faurersg.hpp>
 #include <ql/math/randomnumbers/haltonrsg.hpp>
+#include <ql/math/randomnumbers/inversecumulativersg.hpp>
 #include <ql/math/randomnumbers/mt19937uniformrng.hpp>
 #include <ql/math/randomnumbers/seedgenerator.hpp>
 #include <ql/math/randomnumbers/primitivepolynomials.hpp>
@@ -1091,3 +1093,52 @@ TEST_CASE("LowDiscrepancy_SobolSkipping", "[LowDiscrepancy]") {
       }
     }
 }
+
+TEST_CASE("LowDiscrepancy_SobolBlocks", "[LowDiscrepancy]") {
+    INFO("Testing block generation of Sobol sequences...");
+
+    Size dimension = 37, points = 1000, chunks = 4;
+    Size chunk = points/chunks;
+    SobolRsg rsg(dimension, 42, SobolRsg::JoeKuoD7);
+    std::vector<std::vector<Real> > expected;
+    for (Size i=0; i<points; ++i)
+        expected.push_back(rsg.nextSequence().value);
+
+    // each chunk is drawn by a separate generator after skipping
+    std::vector<Real> block(chunk*dimension);
+    for (Size c=0; c<chunks; ++c) {
+        SobolRsg chunkRsg(dimension, 42, SobolRsg::JoeKuoD7);
+        chunkRsg.skipTo(c*chunk);
+        chunkRsg.nextBlock(chunk, block.data());
+        for (Size i=0; i<chunk; ++i) {
+            for (Size k=0; k<dimension; ++k) {
+                if (block[i*dimension+k] != expected[c*chunk+i][k])
+                    FAIL("mismatch in block " << c << ":"
+                         << "\n  point:      " << c*chunk+i
+                         << "\n  coordinate: " << k
+                         << "\n  expected:   " << expected[c*chunk+i][k]
+                         << "\n  found:      " << block[i*dimension+k]);
+            }
+        }
+        if (chunkRsg.lastSequence().value != expected[(c+1)*chunk-1])
+            FAIL_CHECK("last sequence not set to the last point of block "
+                       << c);
+    }
+
+    // transformed blocks
+    typedef InverseCumulativeRsg<SobolRsg, InverseCumulativeNormal> rsg_type;
+    rsg_type gaussianRsg1(SobolRsg(dimension, 42, SobolRsg::JoeKuoD7));
+    rsg_type gaussianRsg2(SobolRsg(dimension, 42, SobolRsg::JoeKuoD7));
+    gaussianRsg2.nextBlock(chunk, block.data());
+    for (Size i=0; i<chunk; ++i) {
+        const std::vector<Real>& sample = gaussianRsg1.nextSequence().value;
+        for (Size k=0; k<dimension; ++k) {
+            if (block[i*dimension+k] != sample[k])
+                FAIL("mismatch in transformed block:"
+                     << "\n  point:      " << i
+                     << "\n  coordinate: " << k
+                     << "\n  expected:   " << sample[k]
+                     << "\n  found:      " << block[i*dimension+k]);
+        }
+    }
+}
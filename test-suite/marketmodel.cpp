@@ -799,6 +799,245 @@ TEST_CASE("MarketModel_OneStepForwardsAndOptionlets", "[MarketModel]") {
     }
 }
 
+TEST_CASE("MarketModel_MultiThreadedAccountingEngine", "[MarketModel]") {
+
+    INFO("Testing multi-threaded accounting engine "
+                 "in a lognormal forward rate market model...");
+
+    setup();
+
+    std::vector<Rate> forwardStrikes(todaysForwards.size());
+    std::vector<std::shared_ptr<Payoff> > optionletPayoffs(todaysForwards.size());
+    std::vector<std::shared_ptr<StrikedTypePayoff> >
+            displacedPayoffs(todaysForwards.size());
+    for (Size i = 0; i < todaysForwards.size(); ++i) {
+        forwardStrikes[i] = todaysForwards[i] + 0.01;
+        optionletPayoffs[i] = std::make_shared<PlainVanillaPayoff>(Option::Call, todaysForwards[i]);
+        displacedPayoffs[i] = std::make_shared<PlainVanillaPayoff>(Option::Call, todaysForwards[i] + displacement);
+    }
+
+    OneStepForwards forwards(rateTimes, accruals,
+                             paymentTimes, forwardStrikes);
+    OneStepOptionlets optionlets(rateTimes, accruals,
+                                 paymentTimes, optionletPayoffs);
+
+    MultiProductComposite product;
+    product.add(forwards);
+    product.add(optionlets);
+    product.finalize();
+
+    EvolutionDescription evolution = product.evolution();
+    std::vector<Size> numeraires = makeMeasure(product, Terminal);
+    std::shared_ptr<MarketModel> marketModel =
+            makeMarketModel(true, evolution, todaysForwards.size(),
+                            ExponentialCorrelationFlatVolatility);
+    AccountingEngine::EvolverFactory evolverFactory =
+            [&](const BrownianGeneratorFactory& generatorFactory) {
+                return makeMarketModelEvolver(marketModel, numeraires,
+                                              generatorFactory, Pc);
+            };
+    Real initialNumeraireValue = todaysDiscounts[numeraires.front()];
+    Size threads = 3;
+    auto generatorFactory =
+        std::make_shared<MTBrownianGeneratorFactory>(seed_);
+
+    AccountingEngine multiThreaded(evolverFactory, generatorFactory,
+                                   product, initialNumeraireValue, threads);
+    SequenceStatisticsInc calculated(product.numberOfProducts());
+    multiThreaded.multiplePathValues(calculated, paths_);
+
+    // each thread simulates a contiguous block of paths with the
+    // generators of its own stream; simulating the same blocks one
+    // after the other must give the same results
+    SequenceStatisticsInc expected(product.numberOfProducts());
+    Size blockSize = (paths_ + threads - 1) / threads;
+    for (Size i = 0; i < threads; ++i) {
+        Size firstPath = std::min(paths_, i*blockSize);
+        Size paths = std::min(paths_, firstPath + blockSize) - firstPath;
+        AccountingEngine singleThreaded(
+                evolverFactory(StreamBrownianGeneratorFactory(
+                                       generatorFactory, i, firstPath)),
+                product, initialNumeraireValue);
+        singleThreaded.multiplePathValues(expected, paths);
+    }
+
+    if (calculated.samples() != expected.samples())
+        FAIL_CHECK(calculated.samples() << " samples simulated instead of "
+                   << expected.samples());
+    std::vector<Real> means = calculated.mean(),
+                      expectedMeans = expected.mean();
+    for (Size i = 0; i < means.size(); ++i) {
+        if (means[i] != expectedMeans[i])
+            FAIL_CHECK("multi-threaded simulation differs "
+                       "from sequential simulation of its streams:"
+                       << std::setprecision(12)
+                       << "\n    product:    " << i
+                       << "\n    calculated: " << means[i]
+                       << "\n    expected:   " << expectedMeans[i]);
+    }
+
+    // The results must also be within a few standard errors of the
+    // exact values.  The check in checkForwardsAndOptionlets is not
+    // used here: it also fails when all the discrepancies have the
+    // same sign, which for these correlated products happens for a
+    // sizable fraction of seeds even without any bias, and the
+    // streams drawn here change with the number of threads.
+    std::vector<Real> errors = calculated.errorEstimate();
+    Size N = todaysForwards.size();
+    Real errorThreshold = 4.0;
+    for (Size i = 0; i < N; ++i) {
+        Real expectedForward = (todaysForwards[i] - forwardStrikes[i])
+                               * accruals[i] * todaysDiscounts[i + 1];
+        Real forwardDiscrepancy = (means[i] - expectedForward) / errors[i];
+        if (std::fabs(forwardDiscrepancy) > errorThreshold)
+            FAIL_CHECK(io::ordinal(i + 1) << " forward: "
+                       << io::rate(means[i]) << "\t"
+                       << io::rate(expectedForward)
+                       << "; discrepancy = " << forwardDiscrepancy);
+
+        Real expectedCaplet =
+            BlackCalculator(displacedPayoffs[i],
+                            todaysForwards[i] + displacement,
+                            volatilities[i] * std::sqrt(rateTimes[i]),
+                            todaysDiscounts[i + 1] * accruals[i]).value();
+        Real capletDiscrepancy =
+            (means[i + N] - expectedCaplet) / errors[i + N];
+        if (std::fabs(capletDiscrepancy) > errorThreshold)
+            FAIL_CHECK(io::ordinal(i + 1) << " caplet: "
+                       << io::rate(means[i + N]) << "\t"
+                       << io::rate(expectedCaplet)
+                       << "; discrepancy = " << capletDiscrepancy);
+    }
+}
+
+
+TEST_CASE("MarketModel_MultiThreadedSobolAccountingEngine", "[MarketModel]") {
+
+    INFO("Testing multi-threaded accounting engine "
+                 "with Sobol generators...");
+
+    setup();
+
+    std::vector<Rate> forwardStrikes(todaysForwards.size());
+    std::vector<std::shared_ptr<Payoff> > optionletPayoffs(todaysForwards.size());
+    for (Size i = 0; i < todaysForwards.size(); ++i) {
+        forwardStrikes[i] = todaysForwards[i] + 0.01;
+        optionletPayoffs[i] = std::make_shared<PlainVanillaPayoff>(Option::Call, todaysForwards[i]);
+    }
+
+    OneStepForwards forwards(rateTimes, accruals,
+                             paymentTimes, forwardStrikes);
+    OneStepOptionlets optionlets(rateTimes, accruals,
+                                 paymentTimes, optionletPayoffs);
+
+    MultiProductComposite product;
+    product.add(forwards);
+    product.add(optionlets);
+    product.finalize();
+
+    EvolutionDescription evolution = product.evolution();
+    std::vector<Size> numeraires = makeMeasure(product, Terminal);
+    std::shared_ptr<MarketModel> marketModel =
+            makeMarketModel(true, evolution, todaysForwards.size(),
+                            ExponentialCorrelationFlatVolatility);
+    AccountingEngine::EvolverFactory evolverFactory =
+            [&](const BrownianGeneratorFactory& generatorFactory) {
+                return makeMarketModelEvolver(marketModel, numeraires,
+                                              generatorFactory, Pc);
+            };
+    Real initialNumeraireValue = todaysDiscounts[numeraires.front()];
+    auto generatorFactory =
+        std::make_shared<SobolBrownianGeneratorFactory>(
+                                      SobolBrownianGenerator::Diagonal, seed_);
+
+    // the threads draw contiguous blocks of a single Sobol sequence,
+    // so that the paths don't depend on the number of threads, also
+    // across calls
+    AccountingEngine singleThreaded(evolverFactory(*generatorFactory),
+                                    product, initialNumeraireValue);
+    SequenceStatisticsInc expected(product.numberOfProducts());
+    singleThreaded.multiplePathValues(expected, paths_);
+
+    Size threads = 3;
+    AccountingEngine multiThreaded(evolverFactory, generatorFactory,
+                                   product, initialNumeraireValue, threads);
+    SequenceStatisticsInc calculated(product.numberOfProducts());
+    multiThreaded.multiplePathValues(calculated, paths_/2);
+    multiThreaded.multiplePathValues(calculated, paths_ - paths_/2);
+
+    if (calculated.samples() != expected.samples())
+        FAIL_CHECK(calculated.samples() << " samples simulated instead of "
+                   << expected.samples());
+    std::vector<Real> means = calculated.mean(),
+                      expectedMeans = expected.mean();
+    for (Size i = 0; i < means.size(); ++i) {
+        if (means[i] != expectedMeans[i])
+            FAIL_CHECK("multi-threaded Sobol simulation differs "
+                       "from single-threaded one:"
+                       << std::setprecision(12)
+                       << "\n    product:    " << i
+                       << "\n    calculated: " << means[i]
+                       << "\n    expected:   " << expectedMeans[i]);
+    }
+}
+
+TEST_CASE("MarketModel_MultiThreadedPathwiseAccountingEngine", "[MarketModel]") {
+
+    INFO("Testing multi-threaded pathwise accounting engine "
+                 "in a lognormal forward rate market model...");
+
+    setup();
+
+    MarketModelPathwiseMultiCaplet product(rateTimes, accruals,
+                                           paymentTimes, todaysForwards);
+
+    EvolutionDescription evolution = product.evolution();
+    std::vector<Size> numeraires = moneyMarketMeasure(evolution);
+    std::shared_ptr<MarketModel> marketModel =
+            makeMarketModel(true, evolution, 2,
+                            ExponentialCorrelationAbcdVolatility);
+    PathwiseAccountingEngine::EvolverFactory evolverFactory =
+            [&](const BrownianGeneratorFactory& generatorFactory) {
+                return std::make_shared<LogNormalFwdRateEuler>(
+                                   marketModel, generatorFactory, numeraires);
+            };
+    Real initialNumeraireValue = todaysDiscounts[numeraires.front()];
+    auto generatorFactory =
+        std::make_shared<SobolBrownianGeneratorFactory>(
+                                      SobolBrownianGenerator::Diagonal, seed_);
+
+    Size values = product.numberOfProducts() * (todaysForwards.size() + 1);
+
+    PathwiseAccountingEngine singleThreaded(
+                                  evolverFactory(*generatorFactory), product,
+                                  marketModel, initialNumeraireValue);
+    SequenceStatisticsInc expected(values);
+    singleThreaded.multiplePathValues(expected, paths_);
+
+    Size threads = 3;
+    PathwiseAccountingEngine multiThreaded(evolverFactory, generatorFactory,
+                                           product, marketModel,
+                                           initialNumeraireValue, threads);
+    SequenceStatisticsInc calculated(values);
+    multiThreaded.multiplePathValues(calculated, paths_);
+
+    if (calculated.samples() != expected.samples())
+        FAIL_CHECK(calculated.samples() << " samples simulated instead of "
+                   << expected.samples());
+    std::vector<Real> means = calculated.mean(),
+                      expectedMeans = expected.mean();
+    for (Size i = 0; i < means.size(); ++i) {
+        if (means[i] != expectedMeans[i])
+            FAIL_CHECK("multi-threaded pathwise simulation differs "
+                       "from single-threaded one:"
+                       << std::setprecision(12)
+                       << "\n    value:      " << i
+                       << "\n    calculated: " << means[i]
+                       << "\n    expected:   " << expectedMeans[i]);
+    }
+}
+
+
 TEST_CASE("MarketModel_OneStepNormalForwardsAndOptionlets", "[MarketModel]") {
 
     INFO("Testing exact repricing of "
@@ -3542,6 +3781,115 @@ TEST_CASE("MarketModel_PathwiseVegas", "[MarketModel]") {
 
 }
 
+TEST_CASE("MarketModel_PathwiseAdjointGreeks", "[MarketModel]") {
+
+    INFO("Testing adjoint pathwise deltas and vegas against finite differences...");
+
+    setup();
+
+    EvolutionDescription evolution(rateTimes);
+    Size numberRates = evolution.numberOfRates();
+    Size numberSteps = evolution.numberOfSteps();
+    Size factors = 3;
+    std::shared_ptr<MarketModel> marketModel =
+        makeMarketModel(true, evolution, factors,
+                        ExponentialCorrelationFlatVolatility);
+
+    std::vector<Matrix> pseudoRoots;
+    for (Size s = 0; s < numberSteps; ++s)
+        pseudoRoots.push_back(marketModel->pseudoRoot(s));
+
+    Spread shift = 0.01;
+    std::vector<Spread> displacements(numberRates, shift);
+    std::vector<Size> numeraires = moneyMarketMeasure(evolution);
+    Real initialNumeraireValue = todaysDiscounts[0];
+
+    // one bump per rate, scaling its volatility over all steps
+    std::vector<std::vector<Matrix> > vegaBumps(
+        numberSteps,
+        std::vector<Matrix>(numberRates, Matrix(numberRates, factors, 0.0)));
+    for (Size s = 0; s < numberSteps; ++s)
+        for (Size r = evolution.firstAliveRate()[s]; r < numberRates; ++r)
+            std::copy(pseudoRoots[s].row_begin(r), pseudoRoots[s].row_end(r),
+                      vegaBumps[s][r].row_begin(r));
+    Size entriesPerProduct = 1 + numberRates + numberRates;
+
+    // with the strikes at minus the displacement, the payoffs are
+    // smooth on every path and the pathwise derivatives can be
+    // compared to finite differences on the same paths
+    std::vector<Rate> strikes(numberRates, -shift);
+    MarketModelPathwiseMultiCaplet caplets(rateTimes, accruals,
+                                           paymentTimes, strikes);
+    MarketModelPathwiseMultiDeflatedCaplet deflatedCaplets(rateTimes, accruals,
+                                                           paymentTimes, strikes);
+
+    Size paths = 200;
+    auto simulate = [&](const MarketModelPathwiseMultiProduct& product,
+                        const std::vector<Rate>& forwards,
+                        const std::vector<Matrix>& roots,
+                        std::vector<Real>& means) {
+        std::shared_ptr<MarketModel> model =
+            std::make_shared<PseudoRootFacade>(roots, rateTimes,
+                                               forwards, displacements);
+        MTBrownianGeneratorFactory generatorFactory(seed_);
+        std::vector<Real> errors;
+        PathwiseVegasAdjointAccountingEngine engine(
+            std::make_shared<LogNormalFwdRateEuler>(model, generatorFactory,
+                                                    numeraires),
+            product, model, vegaBumps, initialNumeraireValue);
+        engine.multiplePathValues(means, errors, paths);
+    };
+
+    const MarketModelPathwiseMultiProduct* products[] = { &caplets,
+                                                          &deflatedCaplets };
+    Real h = 1.0e-6, tolerance = 1.0e-8;
+
+    for (auto product : products) {
+        std::vector<Real> values, up, down;
+        simulate(*product, todaysForwards, pseudoRoots, values);
+
+        for (Size j = 0; j < numberRates; ++j) {
+            std::vector<Rate> forwards = todaysForwards;
+            forwards[j] += h;
+            simulate(*product, forwards, pseudoRoots, up);
+            forwards[j] -= 2.0 * h;
+            simulate(*product, forwards, pseudoRoots, down);
+
+            for (Size i = 0; i < numberRates; ++i) {
+                Real delta = values[i * entriesPerProduct + 1 + j];
+                Real fdDelta = (up[i * entriesPerProduct] -
+                                down[i * entriesPerProduct]) / (2.0 * h);
+                if (std::fabs(delta - fdDelta) > tolerance)
+                    FAIL_CHECK("caplet " << i << ", rate " << j
+                               << (product->alreadyDeflated() ? " (deflated)" : "")
+                               << ":\n    adjoint delta:    " << delta
+                               << "\n    finite difference: " << fdDelta);
+            }
+        }
+
+        for (Size b = 0; b < numberRates; ++b) {
+            std::vector<Matrix> bumpedUp = pseudoRoots, bumpedDown = pseudoRoots;
+            for (Size s = 0; s < numberSteps; ++s) {
+                bumpedUp[s] += h * vegaBumps[s][b];
+                bumpedDown[s] -= h * vegaBumps[s][b];
+            }
+            simulate(*product, todaysForwards, bumpedUp, up);
+            simulate(*product, todaysForwards, bumpedDown, down);
+
+            for (Size i = 0; i < numberRates; ++i) {
+                Real vega = values[i * entriesPerProduct + 1 + numberRates + b];
+                Real fdVega = (up[i * entriesPerProduct] -
+                               down[i * entriesPerProduct]) / (2.0 * h);
+                if (std::fabs(vega - fdVega) > tolerance)
+                    FAIL_CHECK("caplet " << i << ", bump " << b
+                               << (product->alreadyDeflated() ? " (deflated)" : "")
+                               << ":\n    adjoint vega:     " << vega
+                               << "\n    finite difference: " << fdVega);
+            }
+        }
+    }
+}
+
 TEST_CASE("MarketModel_PathwiseMarketVegas", "[MarketModel]") {
 
     INFO("Testing pathwise market vegas in a lognormal forward rate market model...");
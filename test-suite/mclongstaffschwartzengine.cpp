@@ -20,12 +20,14 @@
 */
 
 #include "utilities.hpp"
+#include <ql/instruments/basketoption.hpp>
 #include <ql/instruments/vanillaoption.hpp>
 #include <ql/termstructures/yield/flatforward.hpp>
 #include <ql/termstructures/volatility/equityfx/blackconstantvol.hpp>
 #include <ql/processes/stochasticprocessarray.hpp>
 #include <ql/methods/montecarlo/lsmbasissystem.hpp>
 #include <ql/pricingengines/mclongstaffschwartzengine.hpp>
+#include <ql/pricingengines/basket/mcamericanbasketengine.hpp>
 #include <ql/pricingengines/vanilla/fdamericanengine.hpp>
 #include <ql/pricingengines/vanilla/mcamericanengine.hpp>
 #include <ql/time/calendars/nullcalendar.hpp>
@@ -83,7 +85,8 @@ namespace {
                 Real requiredTolerance,
                 Size maxSamples,
                 BigNatural seed,
-                Size nCalibrationSamples = Null<Size>())
+                Size nCalibrationSamples = Null<Size>(),
+                bool useBasisSet = false)
                 : MCLongstaffSchwartzEngine<VanillaOption::engine,
                 MultiVariate, RNG>(processes,
                                    timeSteps,
@@ -94,7 +97,8 @@ namespace {
                                    requiredSamples,
                                    requiredTolerance,
                                    maxSamples,
-                                   seed, nCalibrationSamples) {}
+                                   seed, nCalibrationSamples),
+                  useBasisSet_(useBasisSet) {}
 
     protected:
         std::shared_ptr<LongstaffSchwartzPathPricer<MultiPath> >
@@ -112,13 +116,58 @@ namespace {
             std::shared_ptr < AmericanMaxPathPricer > earlyExercisePathPricer =
                     std::make_shared<AmericanMaxPathPricer>(this->arguments_.payoff);
 
+            if (useBasisSet_)
+                return std::make_shared<LongstaffSchwartzPathPricer<MultiPath>>(
+                    this->timeGrid(),
+                    earlyExercisePathPricer,
+                    process->riskFreeRate().currentLink(),
+                    LsmMultiPathBasisSet<LsmBasisSystem::Monomial,2,2>());
+
             return std::make_shared<LongstaffSchwartzPathPricer<MultiPath>>(
                     this->timeGrid(),
                     earlyExercisePathPricer,
                     process->riskFreeRate().currentLink());
         }
+
+        const bool useBasisSet_;
     };
 
+    template <LsmBasisSystem::PolynomType Type>
+    void testBasisSets(const std::string& name) {
+        const Size order = 3, dim = 2;
+        const std::vector<std::function<Real(const Real&)> > pathBasis =
+            LsmBasisSystem::pathBasisSystem(order, Type);
+        const std::vector<std::function<Real(const Array&)> > multiPathBasis =
+            LsmBasisSystem::multiPathBasisSystem(dim, order, Type);
+
+        typedef LsmPathBasisSet<Type,order> PathBasisSet;
+        typedef LsmMultiPathBasisSet<Type,order,dim> MultiPathBasisSet;
+        REQUIRE(PathBasisSet::size() == pathBasis.size());
+        REQUIRE(MultiPathBasisSet::size() == multiPathBasis.size());
+
+        const Real tolerance = 1.0e-14;
+        std::vector<Real> values(MultiPathBasisSet::size());
+        Array x(dim);
+        for (Real x0=-0.9; x0<1.0; x0+=0.3) {
+            PathBasisSet::evaluate(x0, &values[0]);
+            for (Size i=0; i<pathBasis.size(); ++i) {
+                if (std::fabs(values[i] - pathBasis[i](x0)) > tolerance)
+                    FAIL_CHECK(name << " basis function " << i
+                               << " at " << x0 << ": " << values[i]
+                               << " instead of " << pathBasis[i](x0));
+            }
+            x[0] = x0;
+            x[1] = 0.5 - x0/2;
+            MultiPathBasisSet::evaluate(x, &values[0]);
+            for (Size i=0; i<multiPathBasis.size(); ++i) {
+                if (std::fabs(values[i] - multiPathBasis[i](x)) > tolerance)
+                    FAIL_CHECK(name << " multi-path basis function " << i
+                               << " at " << x << ": " << values[i]
+                               << " instead of " << multiPathBasis[i](x));
+            }
+        }
+    }
+
 }
 
 
@@ -307,3 +356,133 @@ TEST_CASE("MCLongstaffSchwartzEngine_AmericanMaxOption", "[MCLongstaffSchwartzEn
         }
     }
 }
+
+TEST_CASE("MCLongstaffSchwartzEngine_StreamingCalibration", "[MCLongstaffSchwartzEngine]") {
+
+    INFO("Testing streaming calibration of Longstaff-Schwartz engines...");
+
+    SavedSettings backup;
+
+    const Date today(15, May, 1998);
+    Settings::instance().evaluationDate() = today;
+    const DayCounter dayCounter = Actual365Fixed();
+
+    Handle<YieldTermStructure> riskFreeTS(
+            std::make_shared<FlatForward>(today, 0.06, dayCounter));
+    Handle<YieldTermStructure> dividendTS(
+            std::make_shared<FlatForward>(today, 0.02, dayCounter));
+    Handle<BlackVolTermStructure> volTS(
+            std::make_shared<BlackConstantVol>(today, NullCalendar(),
+                                               0.25, dayCounter));
+    std::shared_ptr<GeneralizedBlackScholesProcess> stochasticProcess =
+            std::make_shared<GeneralizedBlackScholesProcess>(
+                Handle<Quote>(std::make_shared<SimpleQuote>(36.0)),
+                dividendTS, riskFreeTS, volTS);
+
+    std::shared_ptr<Exercise> exercise =
+            std::make_shared<AmericanExercise>(today, today + 365);
+
+    // the stored and streaming calibrations regress on the same
+    // samples and must agree up to the accuracy of the solvers
+    const Real tolerance = 1.0e-8;
+
+    VanillaOption option(
+        std::make_shared<PlainVanillaPayoff>(Option::Put, 40.0), exercise);
+    Real npv[2];
+    for (Size k=0; k<2; ++k) {
+        option.setPricingEngine(
+            MakeMCAmericanEngine<PseudoRandom>(stochasticProcess)
+                .withSteps(50)
+                .withSamples(4096)
+                .withCalibrationSamples(4096)
+                .withAntitheticVariate()
+                .withSeed(42)
+                .withPolynomOrder(3)
+                .withStreamingCalibration(k == 1));
+        npv[k] = option.NPV();
+    }
+    if (std::fabs(npv[0] - npv[1]) > tolerance)
+        FAIL_CHECK("failed to reproduce american option price"
+                   << "\n    stored calibration:    " << npv[0]
+                   << "\n    streaming calibration: " << npv[1]);
+
+    std::vector<std::shared_ptr<StochasticProcess1D> > processes(
+                                                   2, stochasticProcess);
+    Matrix correlation(2, 2, 0.5);
+    correlation[0][0] = correlation[1][1] = 1.0;
+    std::shared_ptr<StochasticProcessArray> processArray =
+        std::make_shared<StochasticProcessArray>(processes, correlation);
+
+    BasketOption basketOption(
+        std::make_shared<MaxBasketPayoff>(
+            std::make_shared<PlainVanillaPayoff>(Option::Call, 36.0)),
+        exercise);
+    for (Size k=0; k<2; ++k) {
+        basketOption.setPricingEngine(
+            MakeMCAmericanBasketEngine<PseudoRandom>(processArray)
+                .withSteps(25)
+                .withSamples(4096)
+                .withCalibrationSamples(4096)
+                .withSeed(42)
+                .withStreamingCalibration(k == 1));
+        npv[k] = basketOption.NPV();
+    }
+    if (std::fabs(npv[0] - npv[1]) > tolerance)
+        FAIL_CHECK("failed to reproduce american basket option price"
+                   << "\n    stored calibration:    " << npv[0]
+                   << "\n    streaming calibration: " << npv[1]);
+}
+
+TEST_CASE("MCLongstaffSchwartzEngine_BasisSets", "[MCLongstaffSchwartzEngine]") {
+
+    INFO("Testing fixed-order basis sets for Longstaff-Schwartz regression...");
+
+    testBasisSets<LsmBasisSystem::Monomial>("monomial");
+    testBasisSets<LsmBasisSystem::Laguerre>("Laguerre");
+    testBasisSets<LsmBasisSystem::Hermite>("Hermite");
+    testBasisSets<LsmBasisSystem::Hyperbolic>("hyperbolic");
+    testBasisSets<LsmBasisSystem::Legendre>("Legendre");
+    testBasisSets<LsmBasisSystem::Chebyshev>("Chebyshev");
+    testBasisSets<LsmBasisSystem::Chebyshev2nd>("Chebyshev 2nd kind");
+
+    SavedSettings backup;
+
+    const Date today(15, May, 1998);
+    Settings::instance().evaluationDate() = today;
+    const DayCounter dayCounter = Actual365Fixed();
+
+    std::shared_ptr<GeneralizedBlackScholesProcess> stochasticProcess =
+        std::make_shared<GeneralizedBlackScholesProcess>(
+            Handle<Quote>(std::make_shared<SimpleQuote>(100.0)),
+            Handle<YieldTermStructure>(
+                std::make_shared<FlatForward>(today, 0.10, dayCounter)),
+            Handle<YieldTermStructure>(
+                std::make_shared<FlatForward>(today, 0.05, dayCounter)),
+            Handle<BlackVolTermStructure>(
+                std::make_shared<BlackConstantVol>(today, NullCalendar(),
+                                                   0.20, dayCounter)));
+    std::vector<std::shared_ptr<StochasticProcess1D> > processes(
+                                                   2, stochasticProcess);
+    Matrix correlation(2, 2, 0.0);
+    correlation[0][0] = correlation[1][1] = 1.0;
+    std::shared_ptr<StochasticProcessArray> process =
+        std::make_shared<StochasticProcessArray>(processes, correlation);
+
+    VanillaOption option(
+        std::make_shared<PlainVanillaPayoff>(Option::Call, 100.0),
+        std::make_shared<AmericanExercise>(today, today + 3*365));
+
+    // the basis set reproduces the basis system of the path pricer
+    Real npv[2];
+    for (Size k=0; k<2; ++k) {
+        option.setPricingEngine(
+            std::make_shared<MCAmericanMaxEngine<PseudoRandom>>(
+                process, 25, Null<Size>(), false, true, false, 4096,
+                Null<Real>(), Null<Size>(), 42, 1024, k == 1));
+        npv[k] = option.NPV();
+    }
+    if (std::fabs(npv[0] - npv[1]) > 1.0e-10)
+        FAIL_CHECK("failed to reproduce american max option price"
+                   << "\n    basis system: " << npv[0]
+                   << "\n    basis set:    " << npv[1]);
+}
@@ -89,11 +89,87 @@ TEST_CASE("Observable_ObservableSettings", "[Observable]") {
    }
 }
 
+TEST_CASE("Observable_Transaction", "[Observable]") {
+
+    INFO("Testing batched notifications...");
+
+    const std::shared_ptr<SimpleQuote> q1 = std::make_shared<SimpleQuote>(1.0);
+    const std::shared_ptr<SimpleQuote> q2 = std::make_shared<SimpleQuote>(2.0);
+    UpdateCounter both, second;
+    both.registerWith(q1);
+    both.registerWith(q2);
+    second.registerWith(q2);
+
+    {
+        ObservableTransaction transaction;
+        if (!ObservableTransaction::active())
+            FAIL("transaction is not active");
+        for (Size i=0; i < 10; ++i) {
+            q1->setValue(Real(i));
+            q2->setValue(Real(i));
+        }
+        if (both.counter() != 0 || second.counter() != 0)
+            FAIL("notifications were not held back");
+    }
+    if (ObservableTransaction::active())
+        FAIL("transaction is still active");
+    if (both.counter() != 1 || second.counter() != 1)
+        FAIL("update counter values are not one: "
+             << both.counter() << ", " << second.counter());
+
+    {
+        ObservableTransaction outer;
+        {
+            ObservableTransaction inner;
+            q1->setValue(10.0);
+        }
+        if (both.counter() != 1)
+            FAIL("nested transaction delivered its notifications");
+        q2->setValue(10.0);
+        outer.commit();
+        if (both.counter() != 2 || second.counter() != 2)
+            FAIL("update counter values are not two: "
+                 << both.counter() << ", " << second.counter());
+        // notifications after the commit are delivered at once
+        q2->setValue(11.0);
+        if (both.counter() != 3 || second.counter() != 3)
+            FAIL("update counter values are not three: "
+                 << both.counter() << ", " << second.counter());
+    }
+
+    {
+        // observers destroyed during the transaction are not notified
+        ObservableTransaction transaction;
+        std::shared_ptr<UpdateCounter> transient =
+            std::make_shared<UpdateCounter>();
+        transient->registerWith(q1);
+        q1->setValue(12.0);
+        transient.reset();
+    }
+    if (both.counter() != 4)
+        FAIL("update counter value is not four");
+
+    {
+        // updates deferred meanwhile are sent when they're enabled
+        ObservableTransaction transaction;
+        q1->setValue(13.0);
+        ObservableSettings::instance().disableUpdates(true);
+    }
+    if (both.counter() != 4)
+        FAIL("update counter value is not four");
+    ObservableSettings::instance().enableUpdates();
+    if (both.counter() != 5 || second.counter() != 3)
+        FAIL("update counter values are not correct: "
+             << both.counter() << ", " << second.counter());
+}
+
 
 #ifdef QL_ENABLE_THREAD_SAFE_OBSERVER_PATTERN
 
+#include <chrono>
 #include <list>
 #include <thread>
+#include <vector>
 
 namespace {
 
@@ -241,4 +317,66 @@ TEST_CASE("Observable_MultiThreadingGlobalSettings", "[.]") {
         }
     }
 }
+
+TEST_CASE("Observable_NotificationContention", "[Observable]") {
+    INFO("Testing notification throughput under concurrent "
+                       "registrations...");
+
+    // A market-data thread keeps ticking quotes while other threads
+    // register and unregister short-lived observers with them; the
+    // permanent observers must receive every notification.  Run with
+    // -s to see the timings.
+
+    const Size nQuotes = 20, nTicks = 5000, nRegistrationThreads = 3;
+
+    std::vector<std::shared_ptr<SimpleQuote> > quotes;
+    std::vector<std::shared_ptr<MTUpdateCounter> > permanent;
+    for (Size i=0; i < nQuotes; ++i) {
+        quotes.push_back(std::make_shared<SimpleQuote>(0.0));
+        permanent.push_back(std::make_shared<MTUpdateCounter>());
+        permanent.back()->registerWith(quotes.back());
+    }
+
+    auto tick = [&quotes]() {
+        const auto start = std::chrono::steady_clock::now();
+        for (Size j=0; j < nTicks; ++j)
+            for (Size i=0; i < nQuotes; ++i)
+                quotes[i]->setValue(Real(j+1));
+        return std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+    };
+
+    const double uncontended = tick();
+
+    std::atomic<bool> done(false);
+    std::atomic<Size> registrations(0);
+    std::vector<std::thread> registrationThreads;
+    for (Size t=0; t < nRegistrationThreads; ++t) {
+        registrationThreads.emplace_back([&, t]() {
+            for (Size i=t; !done; i=(i+1)%nQuotes) {
+                const std::shared_ptr<MTUpdateCounter> observer =
+                    std::make_shared<MTUpdateCounter>();
+                observer->registerWith(quotes[i]);
+                observer->registerWith(quotes[(i+7)%nQuotes]);
+                observer->unregisterWith(quotes[i]);
+                ++registrations;
+            }
+        });
+    }
+
+    const double contended = tick();
+
+    done = true;
+    for (auto& thread : registrationThreads)
+        thread.join();
+
+    INFO("notifications: " << nQuotes*nTicks
+         << " per pass; uncontended " << uncontended
+         << " s, with " << registrations
+         << " concurrent registration cycles " << contended << " s");
+
+    for (Size i=0; i < nQuotes; ++i)
+        CHECK(permanent[i]->counter() == static_cast<int>(2*nTicks));
+}
+
 #endif
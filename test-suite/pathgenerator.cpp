@@ -18,7 +18,10 @@
 */
 
 #include "utilities.hpp"
+#include <ql/experimental/processes/extendedblackscholesprocess.hpp>
+#include <ql/methods/montecarlo/batchpathgenerator.hpp>
 #include <ql/methods/montecarlo/mctraits.hpp>
+#include <ql/methods/montecarlo/pathpool.hpp>
 #include <ql/processes/blackscholesprocess.hpp>
 #include <ql/processes/geometricbrownianprocess.hpp>
 #include <ql/processes/ornsteinuhlenbeckprocess.hpp>
@@ -137,6 +140,54 @@ namespace {
         }
     }
 
+    void testBatch(const std::shared_ptr<StochasticProcess1D>& process,
+                   const std::string& tag, bool brownianBridge) {
+        typedef PseudoRandom::rsg_type rsg_type;
+
+        BigNatural seed = 42;
+        TimeGrid grid(10.0, 12);
+        PathGenerator<rsg_type> generator(
+            process, grid,
+            PseudoRandom::make_sequence_generator(grid.size()-1, seed),
+            brownianBridge);
+        BatchPathGenerator<rsg_type> batchGenerator(
+            process, grid,
+            PseudoRandom::make_sequence_generator(grid.size()-1, seed),
+            brownianBridge);
+
+        Size batchSizes[] = { 5, 16, 1, 7 };
+        for (Size paths : batchSizes) {
+            const PathBatch& batch = batchGenerator.next(paths);
+            const PathBatch& atBatch = batchGenerator.antithetic();
+            if (batch.size() != paths || atBatch.size() != paths)
+                FAIL_CHECK("using " << tag << " process: batch of "
+                           << batch.size() << " paths returned, "
+                           << paths << " requested");
+            for (Size j=0; j<paths; ++j) {
+                const PathGenerator<rsg_type>::sample_type& sample =
+                    generator.next();
+                Path path = sample.value;
+                Real weight = sample.weight;
+                Path atPath = generator.antithetic().value;
+                if (batch.weight(j) != weight)
+                    FAIL_CHECK("using " << tag << " process: "
+                               << "batch weight differs from path weight");
+                for (Size i=0; i<path.length(); ++i) {
+                    if (batch(i, j) != path[i] || atBatch(i, j) != atPath[i])
+                        FAIL_CHECK("using " << tag << " process "
+                                   << (brownianBridge ? "with " : "without ")
+                                   << "brownian bridge:\n"
+                                   << std::setprecision(16)
+                                   << "    node:              " << i << "\n"
+                                   << "    path:              " << path[i] << "\n"
+                                   << "    batch:             " << batch(i, j) << "\n"
+                                   << "    antithetic path:   " << atPath[i] << "\n"
+                                   << "    antithetic batch:  " << atBatch(i, j));
+                }
+            }
+        }
+    }
+
 }
 
 
@@ -172,6 +223,44 @@ TEST_CASE("PathGenerator_PathGenerator", "[PathGenerator]") {
 }
 
 
+TEST_CASE("PathGenerator_BatchPathGenerator", "[PathGenerator]") {
+
+    INFO("Testing 1-D batch path generation against single paths...");
+
+    SavedSettings backup;
+
+    Settings::instance().evaluationDate() = Date(26, April, 2005);
+
+    Handle<Quote> x0(std::make_shared<SimpleQuote>(100.0));
+    Handle<YieldTermStructure> r(flatRate(0.05, Actual360()));
+    Handle<YieldTermStructure> q(flatRate(0.02, Actual360()));
+    Handle<BlackVolTermStructure> sigma(flatVol(0.20, Actual360()));
+
+    for (bool brownianBridge : { false, true }) {
+        testBatch(std::make_shared<BlackScholesMertonProcess>(x0, q, r, sigma),
+                  "Black-Scholes", brownianBridge);
+        testBatch(std::make_shared<BlackScholesMertonProcess>(
+                      x0, q, r, sigma,
+                      std::make_shared<EulerDiscretization>(), true),
+                  "discretized Black-Scholes", brownianBridge);
+        for (auto scheme : { ExtendedBlackScholesMertonProcess::Euler,
+                             ExtendedBlackScholesMertonProcess::Milstein,
+                             ExtendedBlackScholesMertonProcess::PredictorCorrector })
+            testBatch(std::make_shared<ExtendedBlackScholesMertonProcess>(
+                          x0, q, r, sigma,
+                          std::make_shared<EulerDiscretization>(), scheme),
+                      "extended Black-Scholes", brownianBridge);
+        testBatch(std::make_shared<GeometricBrownianMotionProcess>(
+                      100.0, 0.03, 0.20),
+                  "geometric Brownian", brownianBridge);
+        testBatch(std::make_shared<OrnsteinUhlenbeckProcess>(0.1, 0.20),
+                  "Ornstein-Uhlenbeck", brownianBridge);
+        testBatch(std::make_shared<SquareRootProcess>(0.1, 0.1, 0.20, 10.0),
+                  "square-root", brownianBridge);
+    }
+}
+
+
 TEST_CASE("PathGenerator_MultiPathGenerator", "[PathGenerator]") {
 
     INFO("Testing n-D path generation against cached values...");
@@ -273,3 +362,128 @@ TEST_CASE("PathGenerator_MultiPathGenerator", "[PathGenerator]") {
     testMultiple(process, "square-root", result4, result4a);
 }
 
+
+
+TEST_CASE("PathGenerator_PathPool", "[PathGenerator]") {
+
+    INFO("Testing path generation into a path pool...");
+
+    typedef PseudoRandom::rsg_type rsg_type;
+
+    const TimeGrid grid(5.0, 10);
+    const Size paths = 8;
+    const BigNatural seed = 42;
+
+    // single-factor paths, with their antithetic ones
+    std::shared_ptr<StochasticProcess1D> process =
+        std::make_shared<GeometricBrownianMotionProcess>(100.0, 0.03, 0.20);
+    PathGenerator<rsg_type> generator(
+        process, grid,
+        PseudoRandom::make_sequence_generator(grid.size()-1, seed), true);
+    PathGenerator<rsg_type> poolGenerator(
+        process, grid,
+        PseudoRandom::make_sequence_generator(grid.size()-1, seed), true);
+
+    PathPool pool(grid);
+    pool.reserve(2*paths);
+    const Real* buffer = nullptr;
+    for (Size k=0; k<2; ++k) {
+        pool.clear();
+        std::vector<Real> weights;
+        for (Size j=0; j<paths; ++j) {
+            weights.push_back(poolGenerator.next(pool.add()[0]));
+            poolGenerator.antithetic(pool.add()[0]);
+        }
+        if (pool.size() != 2*paths)
+            FAIL_CHECK(pool.size() << " paths in pool, "
+                       << 2*paths << " expected");
+        if (k == 0)
+            buffer = pool[0][0].begin();
+        else if (pool[0][0].begin() != buffer)
+            FAIL_CHECK("pool memory not reused after clear()");
+
+        Path path(grid);
+        for (Size j=0; j<paths; ++j) {
+            const PathGenerator<rsg_type>::sample_type& sample =
+                generator.next();
+            if (sample.weight != weights[j])
+                FAIL_CHECK("pooled path weight differs from path weight");
+            for (Size a=0; a<2; ++a) {
+                const Path& expected =
+                    a == 0 ? sample.value : generator.antithetic().value;
+                pool.copy(2*j+a, path);
+                for (Size i=0; i<grid.size(); ++i) {
+                    if (pool[2*j+a][0][i] != expected[i] ||
+                        path[i] != expected[i])
+                        FAIL_CHECK((a == 0 ? "" : "antithetic ")
+                                   << "pooled path differs from path:\n"
+                                   << std::setprecision(16)
+                                   << "    node:    " << i << "\n"
+                                   << "    path:    " << expected[i] << "\n"
+                                   << "    pooled:  " << pool[2*j+a][0][i]);
+                }
+            }
+        }
+    }
+
+    // multi-factor paths
+    Matrix correlation(2, 2, 0.6);
+    correlation[0][0] = correlation[1][1] = 1.0;
+    std::vector<std::shared_ptr<StochasticProcess1D> > processes = {
+        std::make_shared<GeometricBrownianMotionProcess>(100.0, 0.03, 0.20),
+        std::make_shared<OrnsteinUhlenbeckProcess>(0.1, 0.20)
+    };
+    std::shared_ptr<StochasticProcess> multiProcess =
+        std::make_shared<StochasticProcessArray>(processes, correlation);
+    MultiPathGenerator<rsg_type> multiGenerator(
+        multiProcess, grid,
+        PseudoRandom::make_sequence_generator(2*(grid.size()-1), seed));
+    MultiPathGenerator<rsg_type> multiPoolGenerator(
+        multiProcess, grid,
+        PseudoRandom::make_sequence_generator(2*(grid.size()-1), seed));
+
+    // the first path, copied into a default-constructed pool, sets
+    // its shape
+    PathPool multiPool;
+    for (Size j=0; j<paths; ++j) {
+        const MultiPath expected = multiGenerator.next().value;
+        const MultiPath antithetic = multiGenerator.antithetic().value;
+        if (j == 0) {
+            multiPool.add(expected);
+            multiPool.add(antithetic);
+            multiPoolGenerator.next();
+        } else {
+            multiPoolGenerator.next(multiPool.add());
+            multiPoolGenerator.antithetic(multiPool.add());
+        }
+        for (Size a=0; a<2; ++a) {
+            const MultiPath& path = a == 0 ? expected : antithetic;
+            const MultiPathView view = multiPool[2*j+a];
+            for (Size l=0; l<2; ++l) {
+                for (Size i=0; i<grid.size(); ++i) {
+                    if (view[l][i] != path[l][i])
+                        FAIL_CHECK((a == 0 ? "" : "antithetic ")
+                                   << "pooled multi-path differs from "
+                                   << "multi-path:\n"
+                                   << std::setprecision(16)
+                                   << "    asset:   " << l << "\n"
+                                   << "    node:    " << i << "\n"
+                                   << "    path:    " << path[l][i] << "\n"
+                                   << "    pooled:  " << view[l][i]);
+                }
+            }
+        }
+    }
+
+    // paths on another grid with as many points are rejected, also
+    // by a cleared pool
+    pool.clear();
+    bool rejected = false;
+    try {
+        pool.add(Path(TimeGrid(4.0, 10)));
+    } catch (Error&) {
+        rejected = true;
+    }
+    if (!rejected)
+        FAIL_CHECK("path on a different time grid added to the pool");
+}
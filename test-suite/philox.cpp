@@ -0,0 +1,141 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include "utilities.hpp"
+#include <ql/math/randomnumbers/philoxuniformrng.hpp>
+#include <ql/math/randomnumbers/rngtraits.hpp>
+
+using namespace QuantLib;
+
+
+TEST_CASE("Philox_Values", "[Philox]") {
+
+    INFO("Testing Philox counter-based generator...");
+
+    typedef PhiloxUniformRng::counter_type counter_type;
+    typedef PhiloxUniformRng::key_type key_type;
+
+    // known-answer tests provided by the Philox authors
+    struct {
+        counter_type counter;
+        key_type key;
+        counter_type expected;
+    } tests[] = {
+        { {{ 0x00000000U, 0x00000000U, 0x00000000U, 0x00000000U }},
+          {{ 0x00000000U, 0x00000000U }},
+          {{ 0x6627e8d5U, 0xe169c58dU, 0xbc57ac4cU, 0x9b00dbd8U }} },
+        { {{ 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU }},
+          {{ 0xffffffffU, 0xffffffffU }},
+          {{ 0x408f276dU, 0x41c83b0eU, 0xa20bc7c6U, 0x6d5451fdU }} },
+        { {{ 0x243f6a88U, 0x85a308d3U, 0x13198a2eU, 0x03707344U }},
+          {{ 0xa4093822U, 0x299f31d0U }},
+          {{ 0xd16cfe09U, 0x94fdccebU, 0x5001e420U, 0x24126ea1U }} }
+    };
+    for (const auto& test : tests) {
+        counter_type result = PhiloxUniformRng::philox(test.counter,
+                                                       test.key);
+        if (result != test.expected)
+            FAIL_CHECK("Philox-4x32-10 bijection failed:"
+                       << std::hex
+                       << "\n    counter:  " << test.counter[0]
+                       << " " << test.counter[1]
+                       << " " << test.counter[2] << " " << test.counter[3]
+                       << "\n    key:      " << test.key[0]
+                       << " " << test.key[1]
+                       << "\n    result:   " << result[0] << " " << result[1]
+                       << " " << result[2] << " " << result[3]
+                       << "\n    expected: " << test.expected[0]
+                       << " " << test.expected[1] << " "
+                       << test.expected[2] << " " << test.expected[3]);
+    }
+
+    // the generator uses the seed as key and the stream index and
+    // block number as counter
+    unsigned long seed = 42, stream = 7;
+    PhiloxUniformRng rng(seed, stream);
+    for (std::uint32_t block=0; block<10; ++block) {
+        counter_type expected = PhiloxUniformRng::philox(
+            {{ block, 0, std::uint32_t(stream), 0 }},
+            {{ std::uint32_t(seed), 0 }});
+        for (Size k=0; k<4; ++k) {
+            unsigned long x = rng.nextInt32();
+            if (x != expected[k])
+                FAIL_CHECK("number " << 4*block+k << " of stream "
+                           << stream << ": " << x << " instead of "
+                           << expected[k]);
+        }
+    }
+}
+
+
+TEST_CASE("Philox_RandomAccess", "[Philox]") {
+
+    INFO("Testing random access to Philox streams...");
+
+    Size n = 1000;
+    PhiloxUniformRng rng(42, 3);
+    std::vector<Real> expected(n);
+    for (Size i=0; i<n; ++i)
+        expected[i] = rng.nextReal();
+
+    // skipping, and batches of sizes not aligned to the blocks
+    Size starts[] = { 0, 1, 2, 3, 4, 5, 13, 100, 997 };
+    std::vector<Real> values(n);
+    for (Size start : starts) {
+        PhiloxUniformRng skipped(42, 3);
+        skipped.skipTo(start);
+        Size i = start;
+        for (Size size=1; i<n; size+=2) {
+            size = std::min(size, n-i);
+            skipped.next(size, &values[i]);
+            for (Size j=0; j<size; ++j) {
+                if (values[i+j] != expected[i+j])
+                    FAIL("mismatch after skipping to " << start << ":"
+                         << "\n    index:    " << i+j
+                         << "\n    expected: " << expected[i+j]
+                         << "\n    found:    " << values[i+j]);
+            }
+            i += size;
+        }
+    }
+
+    // a fixed number of samples is split in blocks of the same stream
+    Size dimension = 13, samples = 100, threads = 3;
+    PhiloxPseudoRandom::rsg_type rsg =
+        PhiloxPseudoRandom::make_sequence_generator(dimension, 42);
+    std::vector<std::vector<Real> > sequences;
+    for (Size i=0; i<samples; ++i)
+        sequences.push_back(rsg.nextSequence().value);
+    for (Size t=0; t<threads; ++t) {
+        Size first = t*samples/threads, last = (t+1)*samples/threads;
+        PhiloxPseudoRandom::rsg_type block =
+            PhiloxPseudoRandom::make_sequence_generator(dimension, 42,
+                                                        t, first);
+        for (Size i=first; i<last; ++i) {
+            if (block.nextSequence().value != sequences[i])
+                FAIL_CHECK("sequence " << i << " differs when drawn from "
+                           "block " << t);
+        }
+    }
+
+    // open-ended simulations draw from different streams
+    PhiloxPseudoRandom::rsg_type other =
+        PhiloxPseudoRandom::make_sequence_generator(dimension, 42,
+                                                    1, Null<Size>());
+    if (other.nextSequence().value == sequences[0])
+        FAIL_CHECK("different streams return the same sequence");
+}
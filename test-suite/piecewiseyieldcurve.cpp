@@ -742,6 +742,135 @@ TEST_CASE("PiecewiseYieldCurve_LocalBootstrapConsistency", "[PiecewiseYieldCurve
 }
 
 
+TEST_CASE("PiecewiseYieldCurve_IncrementalBootstrap", "[PiecewiseYieldCurve]") {
+    INFO("Testing incremental bootstrap of piecewise yield curve...");
+
+    CommonVars vars;
+
+    typedef PiecewiseYieldCurve<Discount,LogLinear> Curve;
+
+    // the helpers of vars.instruments are used by the reference
+    // curve, a copy of them by the incremental one
+    std::shared_ptr<IborIndex> euribor6m = std::make_shared<Euribor6M>();
+    std::vector<std::shared_ptr<RateHelper> > instruments;
+    for (Size i=0; i<vars.deposits; i++) {
+        instruments.push_back(std::make_shared<DepositRateHelper>(
+            Handle<Quote>(vars.rates[i]),
+            depositData[i].n*depositData[i].units,
+            euribor6m->fixingDays(), vars.calendar,
+            euribor6m->businessDayConvention(),
+            euribor6m->endOfMonth(), euribor6m->dayCounter()));
+    }
+    for (Size i=0; i<vars.swaps; i++) {
+        instruments.push_back(std::make_shared<SwapRateHelper>(
+            Handle<Quote>(vars.rates[i+vars.deposits]),
+            swapData[i].n*swapData[i].units, vars.calendar,
+            vars.fixedLegFrequency, vars.fixedLegConvention,
+            vars.fixedLegDayCounter, euribor6m));
+    }
+
+    const std::shared_ptr<Curve> reference = std::make_shared<Curve>(
+        vars.settlementDays, vars.calendar, vars.instruments, Actual360());
+    const std::shared_ptr<Curve> incremental = std::make_shared<Curve>(
+        vars.settlementDays, vars.calendar, instruments, Actual360(),
+        LogLinear(), Curve::bootstrap_type(true));
+
+    const Real tolerance = 1.0e-10;
+    const Size n = vars.deposits+vars.swaps;
+    // late, middle and early quotes, then the evaluation date
+    const Size bumped[] = { n-1, n-3, n/2, 0, n-2 };
+    for (Size k=0; k<=LENGTH(bumped); ++k) {
+        std::vector<Real> before = incremental->data();
+        Size firstAffected = 0;
+        if (k < LENGTH(bumped)) {
+            vars.rates[bumped[k]]->setValue(
+                vars.rates[bumped[k]]->value() + 0.0005);
+            // pillars are sorted as the helpers, plus the reference date
+            firstAffected = bumped[k] + 1;
+        } else {
+            Settings::instance().evaluationDate() =
+                vars.calendar.advance(vars.today, 1, Days);
+        }
+
+        const std::vector<Real>& expected = reference->data();
+        const std::vector<Real>& calculated = incremental->data();
+        REQUIRE(expected.size() == calculated.size());
+        for (Size i=0; i<expected.size(); ++i) {
+            if (std::fabs(expected[i] - calculated[i]) > tolerance)
+                FAIL_CHECK("pillar " << i << " after change " << k << ": "
+                           << calculated[i] << " instead of "
+                           << expected[i]);
+            if (i < firstAffected && calculated[i] != before[i])
+                FAIL_CHECK("pillar " << i << " before the first affected "
+                           "one was modified after change " << k);
+        }
+    }
+}
+
+
+namespace {
+
+    template <class T, class I>
+    void testBootstrapJacobian(CommonVars& vars,
+                               const I& interpolator = I()) {
+
+        typedef PiecewiseYieldCurve<T,I> Curve;
+
+        // helpers in reverse order, to check the order of the columns
+        std::vector<std::shared_ptr<RateHelper> > instruments(
+            vars.instruments.rbegin(), vars.instruments.rend());
+        Curve curve(vars.settlement, instruments, Actual360(), interpolator,
+                    typename Curve::bootstrap_type(false, true));
+
+        const Matrix jacobian = curve.jacobian();
+        const Size n = instruments.size();
+        REQUIRE(jacobian.rows() == curve.data().size());
+        REQUIRE(jacobian.columns() == n);
+
+        // compare with bumping the quotes and bootstrapping again
+        const Real h = 1.0e-5, tolerance = 1.0e-5;
+        for (Size j=0; j<n; ++j) {
+            const std::shared_ptr<SimpleQuote>& quote = vars.rates[n-1-j];
+            const Real value = quote->value();
+            quote->setValue(value + h);
+            const std::vector<Real> up = curve.data();
+            quote->setValue(value - h);
+            const std::vector<Real> down = curve.data();
+            quote->setValue(value);
+            for (Size i=0; i<up.size(); ++i) {
+                Real expected = (up[i] - down[i]) / (2.0*h);
+                if (std::fabs(jacobian[i][j] - expected) >
+                    tolerance * std::max(1.0, std::fabs(expected)))
+                    FAIL_CHECK("derivative of " << io::ordinal(i)
+                               << " data point with respect to "
+                               << io::ordinal(j+1) << " quote: "
+                               << jacobian[i][j] << " instead of "
+                               << expected);
+            }
+        }
+    }
+
+}
+
+
+TEST_CASE("PiecewiseYieldCurve_DiscountJacobian", "[PiecewiseYieldCurve]") {
+    INFO("Testing bootstrap Jacobian of discount curve...");
+
+    CommonVars vars;
+    testBootstrapJacobian<Discount,LogLinear>(vars);
+}
+
+TEST_CASE("PiecewiseYieldCurve_SplineZeroJacobian", "[PiecewiseYieldCurve]") {
+    INFO("Testing bootstrap Jacobian of spline zero-rate curve...");
+
+    CommonVars vars;
+    testBootstrapJacobian<ZeroYield,Cubic>(
+        vars, Cubic(CubicInterpolation::Spline, true,
+                    CubicInterpolation::SecondDerivative, 0.0,
+                    CubicInterpolation::SecondDerivative, 0.0));
+}
+
+
 TEST_CASE("PiecewiseYieldCurve_Observability", "[PiecewiseYieldCurve]") {
 
     INFO("Testing observability of piecewise yield curve...");
@@ -123,8 +123,32 @@ namespace {
         // point operations (not per sec!)
     };
 
-    std::list<double> runTimes;
+    // test cases timed to report the rate at which they generate
+    // a known number of items, e.g., random variates; since their
+    // operation count depends on the data, they are not part of
+    // the benchmark index
+    class Throughput {
+    public:
+        Throughput(const std::string &name, double millionItems)
+                : name_(name), millionItems_(millionItems) {
+        }
+
+        double getMillionItems() const {
+            return millionItems_;
+        }
+
+        std::string getName() const {
+            return name_;
+        }
+
+    private:
+        const std::string name_;
+        const double millionItems_;
+    };
+
+    std::list<double> runTimes, throughputTimes;
     std::list<Benchmark> bm;
+    std::list<Throughput> tp;
     std::chrono::time_point<std::chrono::steady_clock> startT;
     std::chrono::time_point<std::chrono::steady_clock> endT;
 
@@ -142,9 +166,9 @@ namespace {
         */
     }
 
-    void stopTimer() {
+    void stopTimer(std::list<double>& times = runTimes) {
         endT = std::chrono::steady_clock::now();
-        runTimes.emplace_back(static_cast<double>((endT - startT).count()) / 1.0e9);
+        times.emplace_back(static_cast<double>((endT - startT).count()) / 1.0e9);
 
         /* PAPI code
         PAPI_flops(&real_time, &proc_time, &flop, &mflops);
@@ -184,6 +208,22 @@ namespace {
                   << std::fixed << std::setw(8) << std::setprecision(1)
                   << sum / runTimes.size()
                   << " mflops" << std::endl;
+
+        if (tp.empty())
+            return;
+        std::cout << std::endl;
+        iterT = throughputTimes.begin();
+        std::list<Throughput>::const_iterator iterTP = tp.begin();
+        while (iterT != throughputTimes.end()) {
+            std::cout << iterTP->getName()
+                      << std::string(59 - iterTP->getName().length(), ' ') << ":"
+                      << std::fixed << std::setw(8) << std::setprecision(1)
+                      << iterTP->getMillionItems() / (*iterT)
+                      << " M/s" << std::endl;
+            ++iterT;
+            ++iterTP;
+        }
+        std::cout << std::string(75, '-') << std::endl;
     }
 }
 
@@ -203,6 +243,13 @@ int main() {
     bm.emplace_back(Benchmark("BasketOption_TavellaValues", 933.80));
     bm.emplace_back(Benchmark("BasketOption_OddSamples", 642.46));
     bm.emplace_back(Benchmark("BatesModel_DAXCalibration", 1993.35));
+    // counted from the operations of the Sobol scaling, the inverse
+    // cumulative normal, the bridge and the moments (the same work in
+    // both cases), with log and sqrt as one operation each
+    bm.emplace_back(Benchmark("BrownianBridge_MarketModelVariatesPathByPath",
+                              302.04));
+    bm.emplace_back(Benchmark("BrownianBridge_MarketModelVariatesBatch",
+                              302.04));
     bm.emplace_back(Benchmark("ConvertibleBond_Bond", 159.85));
     bm.emplace_back(Benchmark("DigitalOption_MCCashAtHit", 995.87));
     bm.emplace_back(Benchmark("DividendOption_FdEuropeanGreeks", 949.52));
@@ -215,6 +262,8 @@ int main() {
     bm.emplace_back(Benchmark("HestonModel_DAXCalibration", 555.19));
     bm.emplace_back(Benchmark("Interpolation_SabrInterpolation", 2266.06));
     bm.emplace_back(Benchmark("JumpDiffusion_Greeks", 433.77));
+    bm.emplace_back(Benchmark("Matrices_LargeProduct", 134.61));
+    bm.emplace_back(Benchmark("Matrices_LargeProductTextbook", 134.61));
     bm.emplace_back(Benchmark("MarketModelCms_MultiStepCmSwapsAndSwaptions",
                               11497.73));
     bm.emplace_back(Benchmark("MarketModelSmm_MultiStepCoterminalSwapsAndSwaptions",
@@ -224,6 +273,12 @@ int main() {
     bm.emplace_back(Benchmark("RiskStatistics_Results", 300.28));
     bm.emplace_back(Benchmark("ShortRateModel_Swaps", 454.73));
 
+    // millions of Gaussian variates drawn
+    tp.emplace_back(Throughput("RngTraits_InverseCumulativeGaussianThroughput",
+                               4.096));
+    tp.emplace_back(Throughput("RngTraits_ZigguratGaussianThroughput",
+                               4.096));
+
 
     Catch::Session session; // There must be exactly one instance
     Catch::ConfigData configData;
@@ -242,6 +297,15 @@ int main() {
         stopTimer();
     }
 
+    for (std::list<Throughput>::const_iterator iter = tp.begin();
+         iter != tp.end(); ++iter) {
+        configData.testsOrTags = std::vector<std::string>{iter->getName()};
+        session.useConfigData(configData);
+        startTimer();
+        session.run();
+        stopTimer(throughputTimes);
+    }
+
     printResults();
 
 
@@ -21,9 +21,40 @@
 #include "utilities.hpp"
 #include <ql/math/randomnumbers/rngtraits.hpp>
 #include <ql/math/comparison.hpp>
+#include <ql/models/marketmodels/browniangenerators/mtbrowniangenerator.hpp>
+#include <ql/models/marketmodels/browniangenerators/zigguratbrowniangenerator.hpp>
 
 using namespace QuantLib;
 
+namespace {
+
+    // draws the variates for a number of 256-step, 8-factor
+    // market-model paths; the benchmark times this to measure the
+    // throughput of the generator, so the variates are only summed
+    // and their mean checked
+    void testGaussianThroughput(const BrownianGeneratorFactory& factory) {
+        Size factors = 8, steps = 256, paths = 2000;
+        std::shared_ptr<BrownianGenerator> generator =
+            factory.create(factors, steps);
+        std::vector<Real> variates(factors);
+        Real sum = 0.0;
+        for (Size p=0; p<paths; ++p) {
+            generator->nextPath();
+            for (Size j=0; j<steps; ++j) {
+                generator->nextStep(variates);
+                for (Real x : variates)
+                    sum += x;
+            }
+        }
+
+        Real n = static_cast<Real>(paths*steps*factors);
+        // about five standard errors
+        if (std::fabs(sum/n) > 5.0/std::sqrt(n))
+            FAIL_CHECK("unexpected mean of Gaussian variates: " << sum/n);
+    }
+
+}
+
 
 TEST_CASE("RngTraits_Gaussian", "[RngTraits]") {
 
@@ -89,3 +120,54 @@ TEST_CASE("RngTraits_CustomPoisson", "[RngTraits]") {
                    << "    expected:   " << stored);
 }
 
+
+TEST_CASE("RngTraits_Ziggurat", "[RngTraits]") {
+
+    INFO("Testing Ziggurat Gaussian sequence generation...");
+
+    Size dimension = 100;
+    Ziggurat::rsg_type rsg = Ziggurat::make_sequence_generator(dimension,
+                                                               1234);
+    ZigguratRng rng(1234);
+    for (Size i=0; i<10; ++i) {
+        const std::vector<Real>& values = rsg.nextSequence().value;
+        for (Size j=0; j<dimension; ++j) {
+            Real expected = rng.next().value;
+            if (values[j] != expected)
+                FAIL("sequence " << i << " differs from single draws:"
+                     << "\n    index:      " << j
+                     << "\n    calculated: " << values[j]
+                     << "\n    expected:   " << expected);
+        }
+    }
+
+    Ziggurat::rsg_type stream1 =
+        Ziggurat::make_sequence_generator(dimension, 1234, 1, 0);
+    Ziggurat::rsg_type stream2 =
+        Ziggurat::make_sequence_generator(dimension, 1234, 2, 0);
+    Ziggurat::rsg_type stream1Again =
+        Ziggurat::make_sequence_generator(dimension, 1234, 1, 0);
+    const std::vector<Real> values1 = stream1.nextSequence().value;
+    if (stream1Again.nextSequence().value != values1)
+        FAIL_CHECK("stream is not reproducible");
+    if (stream2.nextSequence().value == values1)
+        FAIL_CHECK("different streams return the same sequence");
+
+    testGaussianThroughput(ZigguratBrownianGeneratorFactory(42));
+}
+
+
+TEST_CASE("RngTraits_InverseCumulativeGaussianThroughput", "[RngTraits]") {
+
+    INFO("Testing throughput of inverse-cumulative Gaussian variates...");
+
+    testGaussianThroughput(MTBrownianGeneratorFactory(42));
+}
+
+
+TEST_CASE("RngTraits_ZigguratGaussianThroughput", "[RngTraits]") {
+
+    INFO("Testing throughput of Ziggurat Gaussian variates...");
+
+    testGaussianThroughput(ZigguratBrownianGeneratorFactory(42));
+}
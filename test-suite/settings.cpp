@@ -0,0 +1,130 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include "utilities.hpp"
+#include <ql/evaluationcontext.hpp>
+#include <ql/settings.hpp>
+#include <ql/indexes/indexmanager.hpp>
+#include <ql/termstructures/yield/flatforward.hpp>
+#include <ql/time/calendars/nullcalendar.hpp>
+#include <ql/time/daycounters/actual365fixed.hpp>
+#include <ql/utilities/threadpool.hpp>
+#include <thread>
+
+using namespace QuantLib;
+
+namespace {
+
+    // discount factor for a fixed date on a curve moving with the
+    // evaluation date
+    Real discountAsOf(const Date& evaluationDate, const Date& paymentDate) {
+        Settings::instance().evaluationDate() = evaluationDate;
+        FlatForward curve(0, NullCalendar(), 0.03, Actual365Fixed());
+        return curve.discount(paymentDate);
+    }
+
+}
+
+TEST_CASE("Settings_EvaluationContexts", "[Settings]") {
+
+    INFO("Testing independent evaluation contexts...");
+
+    SavedSettings backup;
+
+    const Date today(15, March, 2022);
+    const Date payment(15, March, 2027);
+    const std::string name = "EVALUATION-CONTEXT-TEST";
+    Settings::instance().evaluationDate() = today;
+
+    const Size nDates = 4;
+    std::vector<Real> expected(nDates);
+    for (Size i=0; i<nDates; ++i)
+        expected[i] = discountAsOf(today + Integer(i), payment);
+    Settings::instance().evaluationDate() = today;
+
+    {
+        EvaluationContext context;
+        {
+            EvaluationContext::Guard guard(context);
+            if (EvaluationContext::current() != context.id())
+                FAIL("context was not made current");
+            if (Settings::instance().evaluationDate() != Date::todaysDate())
+                FAIL("new context does not start with default settings");
+            Settings::instance().evaluationDate() = today + 1;
+            TimeSeries<Real> fixings;
+            fixings[today] = 0.01;
+            IndexManager::instance().setHistory(name, fixings);
+        }
+        if (EvaluationContext::current() != 0)
+            FAIL("default context was not restored");
+        if (Settings::instance().evaluationDate() != today)
+            FAIL("evaluation date of the default context was modified");
+        if (IndexManager::instance().hasHistory(name))
+            FAIL("fixings of the default context were modified");
+
+        EvaluationContext::Guard guard(context);
+        if (Settings::instance().evaluationDate() != today + 1)
+            FAIL("evaluation date of the context was not kept");
+        if (!IndexManager::instance().hasHistory(name))
+            FAIL("fixings of the context were not kept");
+    }
+
+    // concurrent pricing as of different dates
+    std::vector<std::unique_ptr<EvaluationContext> > contexts;
+    for (Size i=0; i<nDates; ++i)
+        contexts.emplace_back(new EvaluationContext);
+    std::vector<Real> errors(nDates, 0.0);
+    std::vector<std::thread> threads;
+    for (Size i=0; i<nDates; ++i) {
+        threads.emplace_back([&, i]() {
+            EvaluationContext::Guard guard(*contexts[i]);
+            for (Size j=0; j<200; ++j) {
+                Real d = discountAsOf(today + Integer(i), payment);
+                errors[i] = std::max(errors[i],
+                                     std::fabs(d - expected[i]));
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    for (Size i=0; i<nDates; ++i) {
+        if (errors[i] != 0.0)
+            FAIL_CHECK("discount as of " << today + Integer(i)
+                       << " in context " << contexts[i]->id()
+                       << " differs from expected value by " << errors[i]);
+    }
+    if (Settings::instance().evaluationDate() != today)
+        FAIL("evaluation date of the default context was modified");
+
+    // tasks run by a thread pool inherit the context of the caller
+    ThreadPool pool(2);
+    for (Size i=0; i<nDates; ++i) {
+        EvaluationContext::Guard guard(*contexts[i]);
+        std::vector<Date> seen(8);
+        pool.parallelFor(seen.size(), [&seen](Size j) {
+            seen[j] = Settings::instance().evaluationDate();
+        });
+        seen.push_back(pool.submit([]() -> Date {
+            return Settings::instance().evaluationDate();
+        }).get());
+        for (const Date& d : seen) {
+            if (d != today + Integer(i))
+                FAIL_CHECK("pool task saw evaluation date " << d
+                           << " instead of " << today + Integer(i));
+        }
+    }
+}
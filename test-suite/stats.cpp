@@ -231,6 +231,54 @@ namespace {
                            << "    calculated: " << calculated[i] << "\n"
                            << "    expected:   " << expected);
         }
+
+        // the statistics of the two halves of the data, merged, must
+        // give the same results
+        GenericSequenceStatistics<S> first(dimension), second(dimension);
+        for (i = 0; i<LENGTH(data); i++) {
+            std::vector<Real> temp(dimension, data[i]);
+            if (i < LENGTH(data)/2)
+                first.add(temp, weights[i]);
+            else
+                second.add(temp, weights[i]);
+        }
+        first.merge(second);
+
+        if (first.samples() != ss.samples())
+            FAIL("SequenceStatistics<" << name << ">: "
+                       << "wrong number of merged samples\n"
+                       << "    calculated: " << first.samples() << "\n"
+                       << "    expected:   " << ss.samples());
+
+        std::vector<Real> means = ss.mean(), variances = ss.variance();
+        Matrix covariance = ss.covariance(),
+               mergedCovariance = first.covariance();
+        std::vector<Real> mergedMeans = first.mean(),
+                          mergedVariances = first.variance();
+        for (i=0; i<dimension; i++) {
+            if (std::fabs(mergedMeans[i]-means[i]) > tolerance)
+                FAIL("SequenceStatistics<" << name << ">: "
+                           << io::ordinal(i+1) << " dimension: "
+                           << "wrong merged mean value\n"
+                           << "    calculated: " << mergedMeans[i] << "\n"
+                           << "    expected:   " << means[i]);
+            if (std::fabs(mergedVariances[i]-variances[i]) > tolerance)
+                FAIL("SequenceStatistics<" << name << ">: "
+                           << io::ordinal(i+1) << " dimension: "
+                           << "wrong merged variance\n"
+                           << "    calculated: " << mergedVariances[i] << "\n"
+                           << "    expected:   " << variances[i]);
+            for (Size j=0; j<dimension; j++) {
+                if (std::fabs(mergedCovariance[i][j]-covariance[i][j])
+                                                               > tolerance)
+                    FAIL("SequenceStatistics<" << name << ">: "
+                               << "wrong merged covariance ("
+                               << i << "," << j << ")\n"
+                               << "    calculated: "
+                               << mergedCovariance[i][j] << "\n"
+                               << "    expected:   " << covariance[i][j]);
+            }
+        }
     }
 
 }